@@ -0,0 +1,379 @@
+// The source code, authored by Zoxemik in 2025
+
+#include "Commandlets/IslandBenchmarkCommandlet.h"
+#include "IslandMeshBuilder.h"
+#include "IslandSurfaceSampler.h"
+#include "IslandTerrainGrid.h"
+#include "Spawner.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+using namespace UE::Geometry;
+
+namespace IslandBenchmark
+{
+	static TArray<int32> ParseIntList(const FString& Params, const TCHAR* Key, const TArray<int32>& Default)
+	{
+		FString Value;
+		if (!FParse::Value(*Params, Key, Value))
+		{
+			return Default;
+		}
+
+		TArray<FString> Parts;
+		Value.ParseIntoArray(Parts, TEXT(","));
+
+		TArray<int32> Result;
+		for (const FString& Part : Parts)
+		{
+			Result.Add(FCString::Atoi(*Part));
+		}
+		return Result;
+	}
+
+	static double Median(TArray<double> Values)
+	{
+		if (Values.Num() == 0)
+		{
+			return 0.0;
+		}
+		Values.Sort();
+		return Values[Values.Num() / 2];
+	}
+}
+
+UIslandBenchmarkCommandlet::UIslandBenchmarkCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = false;
+	LogToConsole = true;
+}
+
+int32 UIslandBenchmarkCommandlet::Main(const FString& Params)
+{
+	const TArray<int32> Resolutions = IslandBenchmark::ParseIntList(Params, TEXT("Resolutions="), { 50 });
+	const TArray<int32> TessellationLevels = IslandBenchmark::ParseIntList(Params, TEXT("Tessellation="), { 0, 2 });
+	const TArray<int32> IslandCounts = IslandBenchmark::ParseIntList(Params, TEXT("Islands="), { 20 });
+	const TArray<int32> Seeds = IslandBenchmark::ParseIntList(Params, TEXT("Seeds="), { 1, 2, 3 });
+
+	int32 Iterations = 3;
+	FParse::Value(*Params, TEXT("Iterations="), Iterations);
+	Iterations = FMath::Max(Iterations, 1);
+
+	TArray<EIslandMeshingMethod> Methods;
+	FString MethodsValue;
+	if (FParse::Value(*Params, TEXT("Methods="), MethodsValue))
+	{
+		TArray<FString> Parts;
+		MethodsValue.ParseIntoArray(Parts, TEXT(","));
+		for (const FString& Part : Parts)
+		{
+			const int64 Value = StaticEnum<EIslandMeshingMethod>()->GetValueByNameString(Part);
+			if (Value != INDEX_NONE)
+			{
+				Methods.Add((EIslandMeshingMethod)Value);
+			}
+			else
+			{
+				UE_LOG(LogTemp, Warning, TEXT("Unknown meshing method %s"), *Part);
+			}
+		}
+	}
+	if (Methods.Num() == 0)
+	{
+		Methods.Add(EIslandMeshingMethod::VoxelSolidify);
+	}
+
+	// Dedicated server profile, collision geometry only
+	const bool bCollisionOnly = FParse::Param(*Params, TEXT("CollisionOnly"));
+
+	// Adaptive tessellation, optionally under a triangle budget
+	const bool bAdaptive = FParse::Param(*Params, TEXT("Adaptive"));
+	int32 TriangleBudget = 0;
+	FParse::Value(*Params, TEXT("TriangleBudget="), TriangleBudget);
+
+	TArray<FBenchmarkResult> Results;
+
+	// Island generation sweep, the cache is off so every iteration runs the full pipeline
+	for (EIslandMeshingMethod Method : Methods)
+	{
+		for (int32 Resolution : Resolutions)
+		{
+			for (int32 TessellationLevel : TessellationLevels)
+			{
+				for (int32 IslandCount : IslandCounts)
+				{
+					for (int32 SeedValue : Seeds)
+					{
+						FIslandGenerationSettings Settings;
+						Settings.Seed.Initialize(SeedValue);
+						Settings.MeshingMethod = Method;
+						Settings.IslandGridResolution = Resolution;
+						Settings.IslandTessellationLevel = TessellationLevel;
+						Settings.MaxNumberOfIslands = IslandCount;
+						Settings.bUseMeshCache = false;
+						Settings.bCollisionOnly = bCollisionOnly;
+						Settings.TessellationMode = bAdaptive ? EIslandTessellationMode::Adaptive : EIslandTessellationMode::Uniform;
+						Settings.TessellationTriangleBudget = TriangleBudget;
+
+						TArray<FIslandShape> Islands;
+						FIslandMeshBuilder::BuildLayout(Settings, Islands);
+
+						FBenchmarkResult& Result = Results.AddDefaulted_GetRef();
+						Result.Name = FString::Printf(TEXT("Island/%s/Res%d/Tess%d%s/Islands%d/Seed%d%s"), *StaticEnum<EIslandMeshingMethod>()->GetNameStringByValue((int64)Method), Resolution, TessellationLevel, bAdaptive ? TEXT("Adaptive") : TEXT(""), IslandCount, SeedValue, bCollisionOnly ? TEXT("/CollisionOnly") : TEXT(""));
+						if (TriangleBudget > 0)
+						{
+							Result.Name += FString::Printf(TEXT("/Budget%d"), TriangleBudget);
+						}
+
+						TArray<double> Times;
+						for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+						{
+							FIslandBuildResult BuildResult;
+							FIslandMeshBuilder Builder(Settings, Islands);
+							Builder.Build(BuildResult);
+
+							Times.Add(BuildResult.Stats.TotalTimeMs);
+							Result.TriangleCount = BuildResult.Mesh.TriangleCount();
+							Result.PeakMemoryMB = FMath::Max(Result.PeakMemoryMB, (double)BuildResult.Stats.PeakMemoryMB);
+						}
+						Result.TimeMs = IslandBenchmark::Median(Times);
+
+						UE_LOG(LogTemp, Display, TEXT("%s: %.2f ms, %d triangles"), *Result.Name, Result.TimeMs, Result.TriangleCount);
+					}
+				}
+			}
+		}
+	}
+
+	FString SpawnerClassPath;
+	if (FParse::Value(*Params, TEXT("Spawner="), SpawnerClassPath))
+	{
+		RunSpawnerBenchmark(SpawnerClassPath, Seeds, Iterations, Results);
+	}
+
+	FString OutputPath = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("IslandBenchmark.json"));
+	FParse::Value(*Params, TEXT("Output="), OutputPath);
+	if (!WriteResults(OutputPath, Results))
+	{
+		UE_LOG(LogTemp, Error, TEXT("Failed to write benchmark results to %s"), *OutputPath);
+		return 1;
+	}
+	UE_LOG(LogTemp, Display, TEXT("Wrote %d benchmark results to %s"), Results.Num(), *OutputPath);
+
+	FString BaselinePath;
+	if (FParse::Value(*Params, TEXT("Baseline="), BaselinePath))
+	{
+		TArray<FBenchmarkResult> Baseline;
+		if (!ReadResults(BaselinePath, Baseline))
+		{
+			UE_LOG(LogTemp, Error, TEXT("Failed to read benchmark baseline %s"), *BaselinePath);
+			return 1;
+		}
+
+		double Tolerance = 0.15;
+		FParse::Value(*Params, TEXT("Tolerance="), Tolerance);
+
+		const int32 NumRegressions = CompareToBaseline(Results, Baseline, Tolerance);
+		if (NumRegressions > 0)
+		{
+			UE_LOG(LogTemp, Error, TEXT("%d benchmark regression(s) against %s"), NumRegressions, *BaselinePath);
+			return 1;
+		}
+	}
+
+	return 0;
+}
+
+void UIslandBenchmarkCommandlet::RunSpawnerBenchmark(const FString& SpawnerClassPath, const TArray<int32>& Seeds, int32 Iterations, TArray<FBenchmarkResult>& OutResults)
+{
+	UClass* SpawnerClass = LoadClass<ASpawner>(nullptr, *SpawnerClassPath);
+	if (!SpawnerClass)
+	{
+		UE_LOG(LogTemp, Error, TEXT("Spawner class %s not found"), *SpawnerClassPath);
+		return;
+	}
+
+	// A bare game world is enough to spawn actors and register instanced components without a renderer
+	UWorld* World = UWorld::CreateWorld(EWorldType::Game, false, TEXT("IslandBenchmarkWorld"));
+	FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+	WorldContext.SetCurrentWorld(World);
+
+	for (int32 SeedValue : Seeds)
+	{
+		// There is no navmesh headless, so the spawner runs its IslandSurface pass on the built island
+		FIslandGenerationSettings Settings;
+		Settings.Seed.Initialize(SeedValue);
+		Settings.bUseMeshCache = false;
+
+		TArray<FIslandShape> Islands;
+		FIslandMeshBuilder::BuildLayout(Settings, Islands);
+
+		FIslandBuildResult BuildResult;
+		FIslandMeshBuilder(Settings, Islands).Build(BuildResult);
+
+		FBenchmarkResult& Result = OutResults.AddDefaulted_GetRef();
+		Result.Name = FString::Printf(TEXT("Spawn/%s/Seed%d"), *SpawnerClass->GetName(), SeedValue);
+
+		TArray<double> Times;
+		for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+		{
+			// The world never begins play, so the spawner only runs the pass it is asked for
+			ASpawner* Spawner = World->SpawnActor<ASpawner>(SpawnerClass);
+			if (!Spawner)
+			{
+				break;
+			}
+			Spawner->SetSeed(FRandomStream(SeedValue));
+
+			// The first iteration also pays for the synchronous loads, the median leaves it out
+			const double StartTime = FPlatformTime::Seconds();
+			Result.InstanceCount = Spawner->SpawnImmediately(BuildResult.Surface, BuildResult.Terrain, FTransform::Identity);
+			Times.Add((FPlatformTime::Seconds() - StartTime) * 1000.0);
+
+			Result.PeakMemoryMB = FMath::Max(Result.PeakMemoryMB, FPlatformMemory::GetStats().UsedPhysical / (1024.0 * 1024.0));
+
+			Spawner->ReleaseSpawnedContent();
+			Spawner->Destroy();
+		}
+		Result.TimeMs = IslandBenchmark::Median(Times);
+
+		UE_LOG(LogTemp, Display, TEXT("%s: %.2f ms, %d actors and instances"), *Result.Name, Result.TimeMs, Result.InstanceCount);
+	}
+
+	GEngine->DestroyWorldContext(World);
+	World->DestroyWorld(false);
+}
+
+bool UIslandBenchmarkCommandlet::WriteResults(const FString& Path, const TArray<FBenchmarkResult>& Results) const
+{
+	FString Output;
+
+	if (FPaths::GetExtension(Path).Equals(TEXT("csv"), ESearchCase::IgnoreCase))
+	{
+		Output = TEXT("Name,TimeMs,TriangleCount,PeakMemoryMB,InstanceCount\n");
+		for (const FBenchmarkResult& Result : Results)
+		{
+			Output += FString::Printf(TEXT("%s,%.3f,%d,%.1f,%d\n"), *Result.Name, Result.TimeMs, Result.TriangleCount, Result.PeakMemoryMB, Result.InstanceCount);
+		}
+	}
+	else
+	{
+		TArray<TSharedPtr<FJsonValue>> Entries;
+		for (const FBenchmarkResult& Result : Results)
+		{
+			TSharedRef<FJsonObject> Entry = MakeShared<FJsonObject>();
+			Entry->SetStringField(TEXT("Name"), Result.Name);
+			Entry->SetNumberField(TEXT("TimeMs"), Result.TimeMs);
+			Entry->SetNumberField(TEXT("TriangleCount"), Result.TriangleCount);
+			Entry->SetNumberField(TEXT("PeakMemoryMB"), Result.PeakMemoryMB);
+			Entry->SetNumberField(TEXT("InstanceCount"), Result.InstanceCount);
+			Entries.Add(MakeShared<FJsonValueObject>(Entry));
+		}
+
+		TSharedRef<FJsonObject> Root = MakeShared<FJsonObject>();
+		Root->SetArrayField(TEXT("Results"), Entries);
+
+		TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Output);
+		if (!FJsonSerializer::Serialize(Root, Writer))
+		{
+			return false;
+		}
+	}
+
+	return FFileHelper::SaveStringToFile(Output, *Path);
+}
+
+bool UIslandBenchmarkCommandlet::ReadResults(const FString& Path, TArray<FBenchmarkResult>& OutResults) const
+{
+	FString Input;
+	if (!FFileHelper::LoadFileToString(Input, *Path))
+	{
+		return false;
+	}
+
+	if (FPaths::GetExtension(Path).Equals(TEXT("csv"), ESearchCase::IgnoreCase))
+	{
+		TArray<FString> Lines;
+		Input.ParseIntoArrayLines(Lines);
+		for (int32 LineIndex = 1; LineIndex < Lines.Num(); ++LineIndex)
+		{
+			TArray<FString> Columns;
+			Lines[LineIndex].ParseIntoArray(Columns, TEXT(","));
+			// Baselines written before InstanceCount have four columns
+			if (Columns.Num() == 4 || Columns.Num() == 5)
+			{
+				FBenchmarkResult& Result = OutResults.AddDefaulted_GetRef();
+				Result.Name = Columns[0];
+				Result.TimeMs = FCString::Atod(*Columns[1]);
+				Result.TriangleCount = FCString::Atoi(*Columns[2]);
+				Result.PeakMemoryMB = FCString::Atod(*Columns[3]);
+				Result.InstanceCount = Columns.Num() == 5 ? FCString::Atoi(*Columns[4]) : 0;
+			}
+		}
+		return true;
+	}
+
+	TSharedPtr<FJsonObject> Root;
+	if (!FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(Input), Root) || !Root.IsValid())
+	{
+		return false;
+	}
+
+	for (const TSharedPtr<FJsonValue>& Value : Root->GetArrayField(TEXT("Results")))
+	{
+		const TSharedPtr<FJsonObject>& Entry = Value->AsObject();
+		FBenchmarkResult& Result = OutResults.AddDefaulted_GetRef();
+		Result.Name = Entry->GetStringField(TEXT("Name"));
+		Result.TimeMs = Entry->GetNumberField(TEXT("TimeMs"));
+		Result.TriangleCount = (int32)Entry->GetNumberField(TEXT("TriangleCount"));
+		Result.PeakMemoryMB = Entry->GetNumberField(TEXT("PeakMemoryMB"));
+
+		int32 InstanceCount = 0;
+		Entry->TryGetNumberField(TEXT("InstanceCount"), InstanceCount);
+		Result.InstanceCount = InstanceCount;
+	}
+	return true;
+}
+
+int32 UIslandBenchmarkCommandlet::CompareToBaseline(const TArray<FBenchmarkResult>& Results, const TArray<FBenchmarkResult>& Baseline, double Tolerance) const
+{
+	int32 NumRegressions = 0;
+
+	for (const FBenchmarkResult& Result : Results)
+	{
+		const FBenchmarkResult* Reference = Baseline.FindByPredicate([&Result](const FBenchmarkResult& Entry) { return Entry.Name == Result.Name; });
+		if (!Reference)
+		{
+			UE_LOG(LogTemp, Display, TEXT("%s: no baseline"), *Result.Name);
+			continue;
+		}
+
+		if (Result.TimeMs > Reference->TimeMs * (1.0 + Tolerance))
+		{
+			UE_LOG(LogTemp, Error, TEXT("%s: %.2f ms, baseline %.2f ms (+%.0f%%)"), *Result.Name, Result.TimeMs, Reference->TimeMs, (Result.TimeMs / FMath::Max(Reference->TimeMs, UE_DOUBLE_SMALL_NUMBER) - 1.0) * 100.0);
+			++NumRegressions;
+		}
+
+		// Same seed and parameters must keep producing the same output
+		if (Result.TriangleCount != Reference->TriangleCount)
+		{
+			UE_LOG(LogTemp, Error, TEXT("%s: %d triangles, baseline %d"), *Result.Name, Result.TriangleCount, Reference->TriangleCount);
+			++NumRegressions;
+		}
+
+		if (Result.InstanceCount != Reference->InstanceCount)
+		{
+			UE_LOG(LogTemp, Error, TEXT("%s: %d actors and instances, baseline %d"), *Result.Name, Result.InstanceCount, Reference->InstanceCount);
+			++NumRegressions;
+		}
+	}
+
+	return NumRegressions;
+}
@@ -0,0 +1,51 @@
+// The source code, authored by Zoxemik in 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "IslandBenchmarkCommandlet.generated.h"
+
+/**
+ * Headless island generation and spawning benchmark, for build agents without a GPU or window.
+ *
+ * UnrealEditor-Cmd <Project> -run=IslandBenchmark -nullrhi -unattended
+ *   -Resolutions=40,50,60 -Tessellation=0,1,2 -Islands=10,20 -Seeds=1,2,3 -Methods=VoxelSolidify,ImplicitSDF,Heightfield
+ *   -Iterations=3 -CollisionOnly -Adaptive -TriangleBudget=200000 -Spawner=/Game/BP_Spawner.BP_Spawner_C -Output=Saved/IslandBenchmark.json -Baseline=<previous output> -Tolerance=0.15
+ *
+ * Output is JSON or CSV depending on the extension. With a baseline, any case slower than the tolerance allows
+ * or producing a different triangle or instance count is reported and the commandlet returns 1. -Spawner runs that
+ * Blueprint's real IslandSurface spawn pass through ASpawner::SpawnImmediately on every seed's island. -CollisionOnly measures the
+ * dedicated server profile, -Adaptive and -TriangleBudget the adaptive and budgeted tessellation.
+ */
+UCLASS()
+class UIslandBenchmarkCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UIslandBenchmarkCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+
+private:
+	struct FBenchmarkResult
+	{
+		FString Name;
+		double TimeMs = 0.0;
+		int32 TriangleCount = 0;
+		double PeakMemoryMB = 0.0;
+
+		// Actors and instances a spawner case placed, 0 for island cases
+		int32 InstanceCount = 0;
+	};
+
+	void RunSpawnerBenchmark(const FString& SpawnerClassPath, const TArray<int32>& Seeds, int32 Iterations, TArray<FBenchmarkResult>& OutResults);
+
+	bool WriteResults(const FString& Path, const TArray<FBenchmarkResult>& Results) const;
+
+	bool ReadResults(const FString& Path, TArray<FBenchmarkResult>& OutResults) const;
+
+	// Returns the number of regressions against the baseline
+	int32 CompareToBaseline(const TArray<FBenchmarkResult>& Results, const TArray<FBenchmarkResult>& Baseline, double Tolerance) const;
+};
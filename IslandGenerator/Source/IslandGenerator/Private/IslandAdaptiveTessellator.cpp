@@ -0,0 +1,169 @@
+// The source code, authored by Zoxemik in 2025
+
+#include "IslandAdaptiveTessellator.h"
+#include "DynamicMesh/MeshNormals.h"
+#include "Async/ParallelFor.h"
+
+using namespace UE::Geometry;
+
+namespace IslandAdaptiveTessellation
+{
+	struct FCandidate
+	{
+		double Error;
+
+		int32 EdgeID;
+
+		// End points when the edge was scored, a split reuses the ID for one of the halves
+		FIndex2i Vertices;
+	};
+
+	// Worst edge on top of the heap
+	static bool IsWorse(const FCandidate& A, const FCandidate& B)
+	{
+		return A.Error > B.Error;
+	}
+
+	// Splits between two cancellation checks
+	static constexpr int32 CancelCheckInterval = 4096;
+}
+
+bool FIslandAdaptiveTessellator::IsCancelled() const
+{
+	return CancelF && CancelF();
+}
+
+double FIslandAdaptiveTessellator::EvaluateEdge(const FDynamicMesh3& Mesh, const TArray<FVector3d>& VertexNormals, int32 EdgeID, FVector3d& OutMidpoint) const
+{
+	const FIndex2i Vertices = Mesh.GetEdgeV(EdgeID);
+	const FVector3d P0 = Mesh.GetVertex(Vertices.A);
+	const FVector3d P1 = Mesh.GetVertex(Vertices.B);
+
+	// Whatever the plane cuts remove is not worth a single triangle
+	if (FMath::Max(P0.Z, P1.Z) < MinZ || FMath::Min(P0.Z, P1.Z) > MaxZ)
+	{
+		return 0.0;
+	}
+
+	if (FVector3d::Distance(P0, P1) < 2.0 * MinEdgeLength)
+	{
+		return 0.0;
+	}
+
+	// Midpoint of the cubic PN edge curve, the same curve uniform PN tessellation would put the vertex on
+	const FVector3d& N0 = VertexNormals[Vertices.A];
+	const FVector3d& N1 = VertexNormals[Vertices.B];
+	const FVector3d B210 = (2.0 * P0 + P1 - FVector3d::DotProduct(P1 - P0, N0) * N0) / 3.0;
+	const FVector3d B120 = (2.0 * P1 + P0 - FVector3d::DotProduct(P0 - P1, N1) * N1) / 3.0;
+	OutMidpoint = (P0 + 3.0 * B210 + 3.0 * B120 + P1) / 8.0;
+
+	const double Error = FVector3d::Distance(OutMidpoint, (P0 + P1) * 0.5);
+
+	const double ShoreDistance = FMath::Abs((P0.Z + P1.Z) * 0.5 - MaxZ);
+	const double ShoreFactor = 1.0 + ShoreWeight * FMath::Clamp(1.0 - ShoreDistance / FMath::Max(ShoreBand, 1.0), 0.0, 1.0);
+
+	return Error * ShoreFactor;
+}
+
+bool FIslandAdaptiveTessellator::Apply(FDynamicMesh3& Mesh) const
+{
+	using namespace IslandAdaptiveTessellation;
+
+	if (TriangleBudget > 0 && Mesh.TriangleCount() >= TriangleBudget)
+	{
+		return !IsCancelled();
+	}
+
+	// Normals of the current surface, split vertices get the average of their edge
+	TArray<FVector3d> VertexNormals;
+	VertexNormals.SetNumZeroed(Mesh.MaxVertexID());
+	ParallelFor(Mesh.MaxVertexID(), [&](int32 VertexID)
+	{
+		if (Mesh.IsVertex(VertexID))
+		{
+			VertexNormals[VertexID] = FMeshNormals::ComputeVertexNormal(Mesh, VertexID);
+		}
+	});
+
+	// Score every edge once up front, in parallel
+	TArray<int32> EdgeIDs;
+	EdgeIDs.Reserve(Mesh.EdgeCount());
+	for (int32 EdgeID : Mesh.EdgeIndicesItr())
+	{
+		EdgeIDs.Add(EdgeID);
+	}
+
+	TArray<double> EdgeErrors;
+	EdgeErrors.SetNumUninitialized(EdgeIDs.Num());
+	ParallelFor(EdgeIDs.Num(), [&](int32 Index)
+	{
+		FVector3d Midpoint;
+		EdgeErrors[Index] = EvaluateEdge(Mesh, VertexNormals, EdgeIDs[Index], Midpoint);
+	});
+
+	TArray<FCandidate> Heap;
+	for (int32 Index = 0; Index < EdgeIDs.Num(); ++Index)
+	{
+		if (EdgeErrors[Index] > MaxError)
+		{
+			Heap.Add({ EdgeErrors[Index], EdgeIDs[Index], Mesh.GetEdgeV(EdgeIDs[Index]) });
+		}
+	}
+	Heap.Heapify(IsWorse);
+
+	auto PushEdge = [&](int32 EdgeID)
+	{
+		FVector3d Midpoint;
+		const double Error = EvaluateEdge(Mesh, VertexNormals, EdgeID, Midpoint);
+		if (Error > MaxError)
+		{
+			Heap.HeapPush({ Error, EdgeID, Mesh.GetEdgeV(EdgeID) }, IsWorse);
+		}
+	};
+
+	int32 NumSplits = 0;
+	while (Heap.Num() > 0 && (TriangleBudget <= 0 || Mesh.TriangleCount() < TriangleBudget))
+	{
+		FCandidate Candidate;
+		Heap.HeapPop(Candidate, IsWorse);
+
+		// Stale entry, the edge was split since it was scored
+		if (!Mesh.IsEdge(Candidate.EdgeID) || Mesh.GetEdgeV(Candidate.EdgeID) != Candidate.Vertices)
+		{
+			continue;
+		}
+
+		FVector3d Midpoint;
+		if (EvaluateEdge(Mesh, VertexNormals, Candidate.EdgeID, Midpoint) <= MaxError)
+		{
+			continue;
+		}
+
+		FDynamicMesh3::FEdgeSplitInfo SplitInfo;
+		if (Mesh.SplitEdge(Candidate.EdgeID, SplitInfo, 0.5) != EMeshResult::Ok)
+		{
+			continue;
+		}
+
+		const int32 NewVertex = SplitInfo.NewVertex;
+		Mesh.SetVertex(NewVertex, Midpoint);
+		if (VertexNormals.Num() <= NewVertex)
+		{
+			VertexNormals.SetNumZeroed(NewVertex + 1);
+		}
+		VertexNormals[NewVertex] = Normalized(VertexNormals[Candidate.Vertices.A] + VertexNormals[Candidate.Vertices.B]);
+
+		// Only the edges at the new vertex are new, every other edge kept its end points and its score
+		for (int32 EdgeID : Mesh.VtxEdgesItr(NewVertex))
+		{
+			PushEdge(EdgeID);
+		}
+
+		if (++NumSplits % CancelCheckInterval == 0 && IsCancelled())
+		{
+			return false;
+		}
+	}
+
+	return !IsCancelled();
+}
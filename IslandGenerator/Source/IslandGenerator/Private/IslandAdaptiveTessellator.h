@@ -0,0 +1,41 @@
+// The source code, authored by Zoxemik in 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "DynamicMesh/DynamicMesh3.h"
+
+// Greedy edge-split refinement. Every edge is scored by how far the PN curve through its end points and normals
+// strays from the straight edge, weighted up near the coastline, and the worst edge is split onto that curve
+// until the error, the minimum edge length or the triangle budget stops it
+class FIslandAdaptiveTessellator
+{
+public:
+	// Hard cap on the triangle count of the refined mesh, 0 leaves only the error and length limits
+	int32 TriangleBudget = 0;
+
+	// Edges are never split into halves shorter than this
+	double MinEdgeLength = 100.0;
+
+	// Deviation from the curved surface, in world units, below which an edge is left alone
+	double MaxError = 4.0;
+
+	// Z band the plane cuts keep, edges entirely outside of it are never refined
+	double MinZ = -390.0;
+	double MaxZ = 0.0;
+
+	// Edges within ShoreBand of MaxZ count up to 1 + ShoreWeight times their error
+	double ShoreBand = 200.0;
+	double ShoreWeight = 4.0;
+
+	TFunction<bool()> CancelF;
+
+	// Returns false if cancelled, the mesh is partially refined then
+	bool Apply(UE::Geometry::FDynamicMesh3& Mesh) const;
+
+private:
+	bool IsCancelled() const;
+
+	// Weighted error of the edge and the point on the curve it would be split at, 0 when it must not be split
+	double EvaluateEdge(const UE::Geometry::FDynamicMesh3& Mesh, const TArray<FVector3d>& VertexNormals, int32 EdgeID, FVector3d& OutMidpoint) const;
+};
@@ -1,165 +1,857 @@
-// The source code, authored by Zoxemik in 2025
-
-#include "IslandConstructor.h"
-#include "IslandPluginInterface.h"
-#include "Kismet/GameplayStatics.h"
-#include "Kismet/KismetMathLibrary.h"
-#include "GameFramework/GameModeBase.h"
-#include "GeometryScript/MeshSubdivideFunctions.h"
-#include "GeometryScript/MeshPrimitiveFunctions.h"
-#include "GeometryScript/MeshBooleanFunctions.h"
-#include "GeometryScript/MeshNormalsFunctions.h"
-#include "GeometryScript/MeshDeformFunctions.h"
-#include "GeometryScript/MeshVoxelFunctions.h"
-#include "GeometryScript/MeshUVFunctions.h"
-#include "Miscellaneous/SpawnMarker.h"
-
-AIslandConstructor::AIslandConstructor()
-{
-	PrimaryActorTick.bCanEverTick = false;
-
-	GetDynamicMeshComponent()->SetCollisionProfileName(UCollisionProfile::BlockAll_ProfileName);
-	GetDynamicMeshComponent()->SetCollisionEnabled(ECollisionEnabled::QueryAndPhysics);
-
-	Seed.Initialize(0);
-
-	MaxNumberOfIslands = 20;
-
-	IslandRadius = 0.0f;
-
-	IslandHeight = 1300.f;
-
-	MaxSpawnDistance = 9976.0f;
-
-	IslandSize = FVector2D(800.f, 5000.f);
-
-	IslandGridResolution = 50; //on high-end PC pref 50 on low-end 60
-
-	IslandTessellationLevel = 2; //on highend PC pref 2 on lowend 0
-}
-
-void AIslandConstructor::BeginPlay()
-{
-	UGameInstance* GameInstance = UGameplayStatics::GetGameInstance(this);
-	if (GameInstance->GetClass()->ImplementsInterface(UIslandPluginInterface::StaticClass()))
-	{
-		// Retrieve the island seed from the game instance
-		Seed = IIslandPluginInterface::Execute_IslandSeed(GameInstance);
-
-		CreateIsland(true);
-	}
-}
-
-void AIslandConstructor::CreateIsland(bool SpawnMarkers)
-{
-	// Get the dynamic mesh component and reset it
-	DynamicMesh = GetDynamicMeshComponent()->GetDynamicMesh();
-    if (!DynamicMesh){ return; }
-    DynamicMesh->Reset();
-
-	// Clear the array of spawn points
-	SpawnPoints.Empty();
-
-	// Loop through the maximum number of islands
-	for (int32 i = 0; i < MaxNumberOfIslands; ++i)
-	{
-		// Generate a random island radius within the specified range
-		IslandRadius = UKismetMathLibrary::RandomFloatInRangeFromStream(Seed, IslandSize.X, IslandSize.Y);
-
-		// Generate a random unit vector and scale it by half the maximum spawn distance
-		FVector RandomVector = UKismetMathLibrary::RandomUnitVectorFromStream(Seed);
-		FVector MaxSpawnDistanceVector = UKismetMathLibrary::Divide_VectorFloat(FVector(MaxSpawnDistance), 2.0f);
-
-		// Calculate the random spawn point
-		FVector RandomSpawnPoints = UKismetMathLibrary::Multiply_VectorVector(RandomVector, MaxSpawnDistanceVector);
-
-		// Add the spawn point to the array and get its index
-		int32 SpawnPointIndex = SpawnPoints.Add(FVector(RandomSpawnPoints.X, RandomSpawnPoints.Y, 0.0f));
-
-		FVector SpawnPosition = SpawnPoints[SpawnPointIndex];
-
-		FTransform IslandTransform = UKismetMathLibrary::MakeTransform(FVector(SpawnPosition.X, SpawnPosition.Y, -800.f), FRotator(0.0f));
-		
-		// Append a cone to the dynamic mesh at the specified transform
-		FGeometryScriptPrimitiveOptions PrimitiveOptions;
-		UGeometryScriptLibrary_MeshPrimitiveFunctions::AppendCone(DynamicMesh, PrimitiveOptions, IslandTransform, IslandRadius, IslandRadius / 4.0f, IslandHeight);
-
-		// If spawn markers are enabled, spawn a marker at the spawn position
-		if (SpawnMarkers)
-		{
-			UWorld* World = GetWorld();
-			if (!World || !SpawnMarkerBlueprint)
-			{
-				UE_LOG(LogTemp, Error, TEXT("SpawnBlueprintSpawnMarker failed: World or SpawnMarkerBlueprint is NULL!"));
-				return;
-			}
-
-			FTransform SpawnPositionTransform = UKismetMathLibrary::Conv_VectorToTransform(SpawnPosition);
-
-			World->SpawnActor<ASpawnMarker>(SpawnMarkerBlueprint, SpawnPositionTransform);
-		}
-	}
-
-	// Append a large box under all islands
-	// make a box bigger than MaxSpawnDistance to act as a 'base'
-	FTransform BoxTransform = UKismetMathLibrary::MakeTransform(FVector(0.0f, 0.0f, -800.f), FRotator(0.0f));
-	float ExtendedMaxSpawnDistance = MaxSpawnDistance + 10000.f;
-
-	FGeometryScriptPrimitiveOptions PrimitiveOptions;
-	DynamicMesh = UGeometryScriptLibrary_MeshPrimitiveFunctions::AppendBox(DynamicMesh, PrimitiveOptions, BoxTransform, ExtendedMaxSpawnDistance, ExtendedMaxSpawnDistance, 400.f);
-
-	// Fills in any cavities or ensures it's a solid volume
-	// Uses IslandGridResolution for voxel resolution
-	FGeometryScriptSolidifyOptions SolidifyOptions;
-	SolidifyOptions.GridParameters.SizeMethod = EGeometryScriptGridSizingMethod::GridResolution;
-	SolidifyOptions.GridParameters.GridCellSize = 0.25f;
-	SolidifyOptions.GridParameters.GridResolution = IslandGridResolution;
-	SolidifyOptions.bSolidAtBoundaries = false;
-	SolidifyOptions.ExtendBounds = 0.0f;
-	SolidifyOptions.SurfaceSearchSteps = 64;
-	DynamicMesh = UGeometryScriptLibrary_MeshVoxelFunctions::ApplyMeshSolidify(DynamicMesh, SolidifyOptions);
-
-	// Recompute normals to ensure smooth or consistent shading
-	DynamicMesh = UGeometryScriptLibrary_MeshNormalsFunctions::SetPerVertexNormals(DynamicMesh);
-
-	// Apply a mild smoothing pass to soften edges
-	FGeometryScriptMeshSelection Selection;
-	FGeometryScriptIterativeMeshSmoothingOptions SmoothingOptions;
-	SmoothingOptions.NumIterations = 6;
-	SmoothingOptions.Alpha = 0.2f;
-	DynamicMesh = UGeometryScriptLibrary_MeshDeformFunctions::ApplyIterativeSmoothingToMesh(DynamicMesh, Selection, SmoothingOptions);
-
-	// Apply PN Tessellation (subdivision) to increase mesh detail
-	FGeometryScriptPNTessellateOptions TessellateOptions;
-	DynamicMesh = UGeometryScriptLibrary_MeshSubdivideFunctions::ApplyPNTessellation(DynamicMesh, TessellateOptions, IslandTessellationLevel);
-
-	// Cut the underside of the mesh (PlaneCut) to flatten it
-	FTransform BottomCutTransform = UKismetMathLibrary::MakeTransform(FVector(0.0f, 0.0f, -390.f), FRotator(180.f, 0.0f, 0.0f));
-	FGeometryScriptMeshPlaneCutOptions BottomCutOptions;
-	BottomCutOptions.bFillHoles = false;
-	BottomCutOptions.HoleFillMaterialID = -1;
-	DynamicMesh = UGeometryScriptLibrary_MeshBooleanFunctions::ApplyMeshPlaneCut(DynamicMesh, BottomCutTransform, BottomCutOptions);
-
-	// Cut/flatten the top of the mesh
-	FTransform TopCutTransform = UKismetMathLibrary::MakeTransform(FVector(0.0f, 0.0f, 0.0f), FRotator(0.0f, 0.0f, 0.0f));
-	FGeometryScriptMeshPlaneCutOptions TopCutOptions;
-	DynamicMesh = UGeometryScriptLibrary_MeshBooleanFunctions::ApplyMeshPlaneCut(DynamicMesh, TopCutTransform, TopCutOptions);
-
-	// Project UVs onto the mesh from a planar projection
-	FTransform UVsPlaneTransform = UKismetMathLibrary::MakeTransform(FVector(0.0f, 0.0f, 0.0f), FRotator(0.0f, 0.0f, 0.0f), FVector(100.f, 100.f, 100.f));
-	UGeometryScriptLibrary_MeshUVFunctions::SetMeshUVsFromPlanarProjection(DynamicMesh, 0, UVsPlaneTransform, Selection);
-
-	// Clear compute meshes if used by geometry script
-	ReleaseAllComputeMeshes();
-
-	// Add a slight offset to the actor to avoid any potential z-fighting
-	AddActorWorldOffset(FVector(0.0f, 0.0f, 0.05f));
-
-	//Send Completed Event to GameMode
-	AGameModeBase* GameMode = UGameplayStatics::GetGameMode(this);
-	if (GameMode && GameMode->GetClass()->ImplementsInterface(UIslandPluginInterface::StaticClass()))
-	{
-		IIslandPluginInterface::Execute_IslandGenerationComplete(GameMode);
-	}
-
-}
\ No newline at end of file
+// The source code, authored by Zoxemik in 2025
+
+#include "IslandConstructor.h"
+#include "IslandPluginInterface.h"
+#include "IslandLayoutResolver.h"
+#include "IslandGenerationSubsystem.h"
+#include "IslandStaticMeshBaker.h"
+#include "IslandTerrainGrid.h"
+#include "Kismet/GameplayStatics.h"
+#include "Kismet/KismetMathLibrary.h"
+#include "GameFramework/GameModeBase.h"
+#include "Async/Async.h"
+#include "Components/DynamicMeshComponent.h"
+#include "Components/StaticMeshComponent.h"
+#include "Miscellaneous/SpawnMarker.h"
+
+using namespace UE::Geometry;
+
+DECLARE_CYCLE_STAT(TEXT("Component Update"), STAT_Island_ComponentUpdate, STATGROUP_IslandGenerator);
+DECLARE_CYCLE_STAT(TEXT("Finalize"), STAT_Island_Finalize, STATGROUP_IslandGenerator);
+
+AIslandConstructor::AIslandConstructor()
+{
+	PrimaryActorTick.bCanEverTick = false;
+
+	GetDynamicMeshComponent()->SetCollisionProfileName(UCollisionProfile::BlockAll_ProfileName);
+	GetDynamicMeshComponent()->SetCollisionEnabled(ECollisionEnabled::QueryAndPhysics);
+
+	Seed.Initialize(0);
+
+	MaxNumberOfIslands = 20;
+
+	IslandRadius = 0.0f;
+
+	bSpawnMarkerActors = true;
+
+	IslandHeight = 1300.f;
+
+	MaxSpawnDistance = 9976.0f;
+
+	IslandSize = FVector2D(800.f, 5000.f);
+
+	IslandGridResolution = 50; //on high-end PC pref 50 on low-end 60
+
+	IslandTessellationLevel = 2; //on highend PC pref 2 on lowend 0
+
+	TessellationMode = EIslandTessellationMode::Uniform;
+
+	TessellationTriangleBudget = 0;
+
+	TessellationMaxError = 4.0f;
+
+	MeshingMethod = EIslandMeshingMethod::VoxelSolidify;
+
+	ImplicitBlendRadius = 400.f;
+
+	bPostProcessImplicitMesh = false;
+
+	SmoothingIterations = 6;
+
+	SmoothingAlpha = 0.2f;
+
+	UVScale = 100.0f;
+
+	OverlapMode = EIslandOverlapMode::CullContained;
+
+	TargetLandCoverage = 0.0f;
+
+	TileGridSize = FIntPoint(1, 1);
+
+	TileCullDistance = 0.0f;
+
+	NumLODs = 1;
+
+	LODDistance = 20000.0f;
+
+	LODResolutionScale = 0.5f;
+
+	bUseMeshCache = true;
+
+	MaxMeshCacheSizeMB = 256;
+
+	bUseStageCache = WITH_EDITOR; // Parameters are tweaked in the editor, a packaged game builds every island once
+
+	MaxStageCacheSizeMB = 256;
+
+	TerrainGridResolution = 512;
+
+	bFinalizeToStaticMesh = false;
+
+	bAsyncGeneration = true;
+
+	bCollisionOnlyOnServer = true;
+
+	GenerationSerial = 0;
+
+	ScheduledJobId = INDEX_NONE;
+
+	bLastSpawnMarkers = true;
+
+	bAppliedZOffset = false;
+
+	bHasFullMesh = false;
+
+	bSeedFromGameInstance = true;
+}
+
+void AIslandConstructor::BeginPlay()
+{
+	// Seeded by whoever spawned us, e.g. a streamed archipelago cell
+	if (!bSeedFromGameInstance)
+	{
+		CreateIsland(SpawnMarkerBlueprint != nullptr);
+		return;
+	}
+
+	UGameInstance* GameInstance = UGameplayStatics::GetGameInstance(this);
+	if (GameInstance->GetClass()->ImplementsInterface(UIslandPluginInterface::StaticClass()))
+	{
+		// Retrieve the island seed from the game instance
+		Seed = IIslandPluginInterface::Execute_IslandSeed(GameInstance);
+
+		CreateIsland(true);
+	}
+}
+
+void AIslandConstructor::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	CancelGeneration();
+
+	// Markers belong to this island, don't leave them behind when it is streamed out
+	if (EndPlayReason == EEndPlayReason::Destroyed)
+	{
+		for (ASpawnMarker* Marker : SpawnedMarkers)
+		{
+			if (IsValid(Marker))
+			{
+				Marker->Destroy();
+			}
+		}
+		SpawnedMarkers.Empty();
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
+#if WITH_EDITOR
+void AIslandConstructor::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	// Parameters changed mid-build, the running result is already stale
+	if (IsGenerating())
+	{
+		RegenerateIsland();
+	}
+}
+#endif
+
+void AIslandConstructor::RegenerateIsland()
+{
+	CreateIsland(bLastSpawnMarkers);
+}
+
+void AIslandConstructor::CancelGeneration()
+{
+	if (ActiveCancelFlag.IsValid())
+	{
+		*ActiveCancelFlag = true;
+		ActiveCancelFlag.Reset();
+	}
+
+	ReleaseScheduledJob(false);
+
+	++GenerationSerial;
+}
+
+void AIslandConstructor::ReleaseScheduledJob(bool bCompleted)
+{
+	if (ScheduledJobId == INDEX_NONE)
+	{
+		return;
+	}
+
+	if (UIslandGenerationSubsystem* Scheduler = UWorld::GetSubsystem<UIslandGenerationSubsystem>(GetWorld()))
+	{
+		if (bCompleted)
+		{
+			Scheduler->CompleteJob(ScheduledJobId);
+		}
+		else
+		{
+			Scheduler->CancelJob(ScheduledJobId);
+		}
+	}
+
+	ScheduledJobId = INDEX_NONE;
+}
+
+void AIslandConstructor::QueryTerrain(const TArray<FVector>& Locations, TArray<FIslandTerrainSample>& OutSamples) const
+{
+	OutSamples.SetNum(Locations.Num());
+	if (!TerrainGrid.IsValid())
+	{
+		for (FIslandTerrainSample& TerrainSample : OutSamples)
+		{
+			TerrainSample = FIslandTerrainSample();
+		}
+		return;
+	}
+
+	TerrainGrid->SampleBatch(Locations, OutSamples);
+}
+
+bool AIslandConstructor::GetTerrainSample(const FVector& Location, FIslandTerrainSample& OutSample) const
+{
+	OutSample = FIslandTerrainSample();
+	return TerrainGrid.IsValid() && TerrainGrid->Sample(Location, OutSample);
+}
+
+bool AIslandConstructor::GetTerrainHeight(const FVector& Location, float& OutHeight) const
+{
+	return TerrainGrid.IsValid() && TerrainGrid->GetHeight(Location, OutHeight);
+}
+
+bool AIslandConstructor::GetTerrainNormal(const FVector& Location, FVector& OutNormal) const
+{
+	return TerrainGrid.IsValid() && TerrainGrid->GetNormal(Location, OutNormal);
+}
+
+bool AIslandConstructor::GetTerrainSlope(const FVector& Location, float& OutSlopeAngle) const
+{
+	return TerrainGrid.IsValid() && TerrainGrid->GetSlopeAngle(Location, OutSlopeAngle);
+}
+
+bool AIslandConstructor::IsLandAt(const FVector& Location) const
+{
+	return TerrainGrid.IsValid() && TerrainGrid->IsLand(Location);
+}
+
+bool AIslandConstructor::GetBiomeAt(const FVector& Location, EIslandBiome& OutBiome) const
+{
+	return TerrainGrid.IsValid() && TerrainGrid->GetBiome(Location, OutBiome);
+}
+
+void AIslandConstructor::SetSeed(const FRandomStream& InSeed)
+{
+	Seed = InSeed;
+	bSeedFromGameInstance = false;
+}
+
+bool AIslandConstructor::FindNearestIsland(const FVector& Location, FIslandDescriptor& OutIsland) const
+{
+	const FIslandDescriptor* Nearest = nullptr;
+	double NearestDistance = TNumericLimits<double>::Max();
+	for (const FIslandDescriptor& Island : IslandDescriptors)
+	{
+		const double Distance = FMath::Max(FVector::Dist2D(Location, Island.Center) - Island.ShoreRadius, 0.0);
+		if (Distance < NearestDistance)
+		{
+			Nearest = &Island;
+			NearestDistance = Distance;
+		}
+	}
+
+	if (!Nearest)
+	{
+		return false;
+	}
+
+	OutIsland = *Nearest;
+	return true;
+}
+
+void AIslandConstructor::FindIslandsInRadius(const FVector& Location, float Radius, TArray<FIslandDescriptor>& OutIslands) const
+{
+	OutIslands.Reset();
+	for (const FIslandDescriptor& Island : IslandDescriptors)
+	{
+		if (FVector::DistSquared2D(Location, Island.Center) <= FMath::Square(Radius + Island.ShoreRadius))
+		{
+			OutIslands.Add(Island);
+		}
+	}
+}
+
+bool AIslandConstructor::FindIslandAt(const FVector& Location, FIslandDescriptor& OutIsland) const
+{
+	const FIslandDescriptor* Found = nullptr;
+	double FoundDistanceSquared = TNumericLimits<double>::Max();
+	for (const FIslandDescriptor& Island : IslandDescriptors)
+	{
+		const double DistanceSquared = FVector::DistSquared2D(Location, Island.Center);
+		if (DistanceSquared <= FMath::Square(Island.ShoreRadius) && DistanceSquared < FoundDistanceSquared)
+		{
+			Found = &Island;
+			FoundDistanceSquared = DistanceSquared;
+		}
+	}
+
+	if (!Found)
+	{
+		return false;
+	}
+
+	OutIsland = *Found;
+	return true;
+}
+
+FIslandGenerationSettings AIslandConstructor::MakeGenerationSettings() const
+{
+	FIslandGenerationSettings Settings;
+	Settings.Seed = Seed;
+	Settings.MaxNumberOfIslands = MaxNumberOfIslands;
+	Settings.IslandHeight = IslandHeight;
+	Settings.MaxSpawnDistance = MaxSpawnDistance;
+	Settings.IslandSize = IslandSize;
+	Settings.IslandGridResolution = IslandGridResolution;
+	Settings.IslandTessellationLevel = IslandTessellationLevel;
+	Settings.TessellationMode = TessellationMode;
+	Settings.TessellationTriangleBudget = TessellationTriangleBudget;
+	Settings.TessellationMaxError = TessellationMaxError;
+	Settings.MeshingMethod = MeshingMethod;
+	Settings.ImplicitBlendRadius = ImplicitBlendRadius;
+	Settings.bPostProcessImplicitMesh = bPostProcessImplicitMesh;
+	Settings.SmoothingIterations = SmoothingIterations;
+	Settings.SmoothingAlpha = SmoothingAlpha;
+	Settings.UVScale = UVScale;
+	Settings.OverlapMode = OverlapMode;
+	Settings.TargetLandCoverage = TargetLandCoverage;
+	Settings.TileGridSize = TileGridSize;
+	Settings.bUseMeshCache = bUseMeshCache;
+	Settings.MaxMeshCacheSizeMB = MaxMeshCacheSizeMB;
+	Settings.bUseStageCache = bUseStageCache;
+	Settings.MaxStageCacheSizeMB = MaxStageCacheSizeMB;
+	Settings.NumLODs = FMath::Max(NumLODs, 1);
+	Settings.LODResolutionScale = LODResolutionScale;
+	Settings.TerrainGridResolution = TerrainGridResolution;
+	Settings.BiomeRules = BiomeRules;
+
+	// Only render data is skipped, the geometry has to match the clients' for collision and placement to agree
+	if (UseServerProfile())
+	{
+		Settings.bCollisionOnly = true;
+		Settings.NumLODs = 1;
+	}
+	return Settings;
+}
+
+bool AIslandConstructor::UseServerProfile() const
+{
+	return bCollisionOnlyOnServer && GetNetMode() == NM_DedicatedServer;
+}
+
+void AIslandConstructor::CreateIsland(bool SpawnMarkers)
+{
+	// Get the dynamic mesh component, the mesh itself is only reset once the new one is ready
+	DynamicMesh = GetDynamicMeshComponent()->GetDynamicMesh();
+	if (!DynamicMesh){ return; }
+
+	// Drop whatever build is still running, its parameters are out of date
+	CancelGeneration();
+	bLastSpawnMarkers = SpawnMarkers;
+
+	// Baked meshes can't be edited, the new build starts over with coarse LODs first
+	if (IsFinalized())
+	{
+		ClearFinalizedMeshes();
+		bHasFullMesh = false;
+	}
+
+	// Clear the islands and markers from a previous build
+	IslandDescriptors.Reset();
+	for (ASpawnMarker* Marker : SpawnedMarkers)
+	{
+		if (IsValid(Marker))
+		{
+			Marker->Destroy();
+		}
+	}
+	SpawnedMarkers.Empty();
+
+	// Roll the layout on the game thread, it is cheap and the markers need it right away
+	const FIslandGenerationSettings Settings = MakeGenerationSettings();
+	TArray<FIslandShape> Islands;
+	FIslandMeshBuilder::BuildLayout(Settings, Islands);
+
+	UWorld* World = GetWorld();
+	const FTransform ActorTransform = GetActorTransform();
+	for (const FIslandShape& Island : Islands)
+	{
+		FIslandDescriptor& Descriptor = IslandDescriptors.AddDefaulted_GetRef();
+		Descriptor.Center = ActorTransform.TransformPosition(Island.Center);
+		Descriptor.Radius = Island.Radius;
+		Descriptor.Height = Island.Height;
+		Descriptor.ShoreRadius = (float)FIslandLayoutResolver::GetShoreRadius(Island);
+
+		// Marker actors are only a visualization of the descriptors
+		if (SpawnMarkers && bSpawnMarkerActors)
+		{
+			if (!World || !SpawnMarkerBlueprint)
+			{
+				UE_LOG(LogTemp, Error, TEXT("SpawnBlueprintSpawnMarker failed: World or SpawnMarkerBlueprint is NULL!"));
+				continue;
+			}
+
+			FTransform SpawnPositionTransform = UKismetMathLibrary::Conv_VectorToTransform(Descriptor.Center);
+
+			SpawnedMarkers.Add(World->SpawnActor<ASpawnMarker>(SpawnMarkerBlueprint, SpawnPositionTransform));
+		}
+	}
+
+	TrimLODs(Settings.NumLODs - 1);
+
+	if (bAsyncGeneration)
+	{
+		// In a game world the build waits for a free slot in the scheduler, islands nearest to a player first
+		if (UIslandGenerationSubsystem* Scheduler = UWorld::GetSubsystem<UIslandGenerationSubsystem>(World))
+		{
+			TWeakObjectPtr<AIslandConstructor> WeakThis(this);
+			ScheduledJobId = Scheduler->QueueJob(this, EIslandJobType::Generation, GetActorLocation(), FIslandMeshBuilder::EstimatePeakMemory(Settings),
+				[WeakThis, Settings, Islands = MoveTemp(Islands)]() mutable
+				{
+					if (AIslandConstructor* Constructor = WeakThis.Get())
+					{
+						Constructor->LaunchAsyncBuild(Settings, MoveTemp(Islands));
+					}
+				});
+			return;
+		}
+
+		LaunchAsyncBuild(Settings, MoveTemp(Islands));
+		return;
+	}
+
+	FIslandMeshBuilder Builder(Settings, Islands);
+	for (int32 LODIndex = Settings.NumLODs - 1; LODIndex > 0; --LODIndex)
+	{
+		FDynamicMesh3 LODMesh;
+		Builder.BuildLOD(LODIndex, LODMesh);
+		PublishLOD(LODIndex, MoveTemp(LODMesh));
+	}
+
+	FIslandBuildResult Result;
+	Builder.Build(Result);
+
+	FinishGeneration(MoveTemp(Result));
+}
+
+void AIslandConstructor::LaunchAsyncBuild(const FIslandGenerationSettings& Settings, TArray<FIslandShape> Islands)
+{
+	TSharedPtr<FThreadSafeBool> CancelFlag = MakeShared<FThreadSafeBool>(false);
+	ActiveCancelFlag = CancelFlag;
+
+	const int32 BuildSerial = GenerationSerial;
+	TWeakObjectPtr<AIslandConstructor> WeakThis(this);
+
+	Async(EAsyncExecution::ThreadPool, [WeakThis, Settings, Islands = MoveTemp(Islands), CancelFlag, BuildSerial]()
+	{
+		FIslandMeshBuilder Builder(Settings, Islands);
+		Builder.CancelF = [CancelFlag]() { return (bool)*CancelFlag; };
+
+		// Coarsest LOD first, each one is on screen while the finer ones are still building
+		for (int32 LODIndex = Settings.NumLODs - 1; LODIndex > 0; --LODIndex)
+		{
+			TSharedPtr<FDynamicMesh3> LODMesh = MakeShared<FDynamicMesh3>();
+			if (!Builder.BuildLOD(LODIndex, *LODMesh))
+			{
+				return;
+			}
+
+			AsyncTask(ENamedThreads::GameThread, [WeakThis, LODMesh, CancelFlag, BuildSerial, LODIndex]()
+			{
+				AIslandConstructor* Constructor = WeakThis.Get();
+				if (!Constructor || *CancelFlag || Constructor->GenerationSerial != BuildSerial)
+				{
+					return;
+				}
+
+				Constructor->PublishLOD(LODIndex, MoveTemp(*LODMesh));
+			});
+		}
+
+		TSharedPtr<FIslandBuildResult> Result = MakeShared<FIslandBuildResult>();
+		if (!Builder.Build(*Result))
+		{
+			return;
+		}
+
+		// Only the finished mesh goes back to the game thread
+		AsyncTask(ENamedThreads::GameThread, [WeakThis, Result, CancelFlag, BuildSerial]()
+		{
+			AIslandConstructor* Constructor = WeakThis.Get();
+			if (!Constructor || *CancelFlag || Constructor->GenerationSerial != BuildSerial)
+			{
+				return;
+			}
+
+			Constructor->ActiveCancelFlag.Reset();
+			Constructor->FinishGeneration(MoveTemp(*Result));
+			Constructor->ReleaseScheduledJob(true);
+		});
+	});
+}
+
+void AIslandConstructor::FinishGeneration(FIslandBuildResult&& Result)
+{
+	if (!DynamicMesh){ return; }
+
+	int32 VertexCount = Result.Mesh.VertexCount();
+	int32 TriangleCount = Result.Mesh.TriangleCount();
+
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(IslandGenerator_ComponentUpdate);
+		SCOPE_CYCLE_COUNTER(STAT_Island_ComponentUpdate);
+		const double StartTime = FPlatformTime::Seconds();
+
+		if (Result.Tiles.Num() > 0)
+		{
+			for (const FIslandMeshTile& Tile : Result.Tiles)
+			{
+				VertexCount += Tile.Mesh.VertexCount();
+				TriangleCount += Tile.Mesh.TriangleCount();
+			}
+
+			// The tiles carry the geometry, the root component stays empty
+			DynamicMesh->Reset();
+			PublishTiles(Result.Tiles);
+		}
+		else
+		{
+			ClearTiles();
+
+			// Swap the new mesh into the component in one go
+			DynamicMesh->SetMesh(MoveTemp(Result.Mesh));
+		}
+
+		// Clear compute meshes if used by geometry script
+		ReleaseAllComputeMeshes();
+
+		// LOD 0 is in, every LOD goes to its own distance range
+		bHasFullMesh = true;
+		ApplyLODDistances(0);
+
+		const double ComponentUpdateTime = FPlatformTime::Seconds() - StartTime;
+		FIslandStageScope::Record(Result.Stats, TEXT("ComponentUpdate"), ComponentUpdateTime, VertexCount, TriangleCount);
+		Result.Stats.TotalTimeMs += (float)(ComponentUpdateTime * 1000.0);
+	}
+
+	if (bFinalizeToStaticMesh)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(IslandGenerator_Finalize);
+		SCOPE_CYCLE_COUNTER(STAT_Island_Finalize);
+		const double StartTime = FPlatformTime::Seconds();
+
+		FinalizeMeshes();
+
+		const double FinalizeTime = FPlatformTime::Seconds() - StartTime;
+		FIslandStageScope::Record(Result.Stats, TEXT("Finalize"), FinalizeTime, VertexCount, TriangleCount);
+		Result.Stats.TotalTimeMs += (float)(FinalizeTime * 1000.0);
+	}
+
+	LastGenerationStats = MoveTemp(Result.Stats);
+	SurfaceSampler = MoveTemp(Result.Surface);
+
+	// Add a slight offset to the actor to avoid any potential z-fighting
+	if (!bAppliedZOffset)
+	{
+		AddActorWorldOffset(FVector(0.0f, 0.0f, 0.05f));
+		bAppliedZOffset = true;
+	}
+
+	// Placed once, the grid is read only from here on
+	if (Result.Terrain.IsValid())
+	{
+		Result.Terrain->SetLocalToWorld(GetActorTransform());
+	}
+	TerrainGrid = MoveTemp(Result.Terrain);
+
+	// Surface placement can start right away, without waiting on the navmesh
+	OnSurfaceReady.Broadcast(this);
+
+	//Send Completed Event to GameMode
+	AGameModeBase* GameMode = UGameplayStatics::GetGameMode(this);
+	if (GameMode && GameMode->GetClass()->ImplementsInterface(UIslandPluginInterface::StaticClass()))
+	{
+		IIslandPluginInterface::Execute_IslandGenerationMetrics(GameMode, LastGenerationStats);
+		IIslandPluginInterface::Execute_IslandGenerationComplete(GameMode);
+	}
+}
+
+void AIslandConstructor::PublishTiles(TArray<FIslandMeshTile>& Tiles)
+{
+	// A different grid layout means none of the old tiles line up any more
+	if (TileComponents.Num() != Tiles.Num())
+	{
+		ClearTiles();
+	}
+
+	for (int32 TileIndex = 0; TileIndex < Tiles.Num(); ++TileIndex)
+	{
+		if (!TileComponents.IsValidIndex(TileIndex))
+		{
+			TileComponents.Add(CreateTileComponent(TileIndex));
+			TileHashes.Add(0);
+		}
+
+		UDynamicMeshComponent* TileComponent = TileComponents[TileIndex];
+		TileComponent->SetCullDistance(LODComponents.Num() > 0 ? GetLODStartDistance(1) : TileCullDistance);
+
+		// Unchanged tiles keep their render data, cooked collision and navmesh
+		if (TileHashes[TileIndex] == Tiles[TileIndex].Hash)
+		{
+			continue;
+		}
+
+		TileHashes[TileIndex] = Tiles[TileIndex].Hash;
+		TileComponent->SetMesh(MoveTemp(Tiles[TileIndex].Mesh));
+	}
+}
+
+void AIslandConstructor::ClearTiles()
+{
+	for (UDynamicMeshComponent* TileComponent : TileComponents)
+	{
+		if (TileComponent)
+		{
+			TileComponent->DestroyComponent();
+		}
+	}
+
+	TileComponents.Empty();
+	TileHashes.Empty();
+}
+
+UDynamicMeshComponent* AIslandConstructor::CreateTileComponent(int32 TileIndex)
+{
+	UDynamicMeshComponent* RootMeshComponent = GetDynamicMeshComponent();
+
+	UDynamicMeshComponent* TileComponent = NewObject<UDynamicMeshComponent>(this, *FString::Printf(TEXT("IslandTile_%d"), TileIndex));
+	TileComponent->SetupAttachment(RootMeshComponent);
+
+	// Same collision setup the README asks for on the root component, cooked per tile off the game thread
+	TileComponent->SetCollisionProfileName(UCollisionProfile::BlockAll_ProfileName);
+	TileComponent->SetCollisionEnabled(ECollisionEnabled::QueryAndPhysics);
+	TileComponent->SetComplexAsSimpleCollisionEnabled(true, false);
+	TileComponent->bUseAsyncCooking = true;
+
+	for (int32 MaterialIndex = 0; MaterialIndex < RootMeshComponent->GetNumMaterials(); ++MaterialIndex)
+	{
+		TileComponent->SetMaterial(MaterialIndex, RootMeshComponent->GetMaterial(MaterialIndex));
+	}
+
+	TileComponent->RegisterComponent();
+	return TileComponent;
+}
+
+void AIslandConstructor::PublishLOD(int32 LODIndex, FDynamicMesh3&& Mesh)
+{
+	while (LODComponents.Num() < LODIndex)
+	{
+		LODComponents.Add(CreateLODComponent(LODComponents.Num() + 1));
+	}
+
+	LODComponents[LODIndex - 1]->SetMesh(MoveTemp(Mesh));
+
+	// On a regeneration the previous full mesh keeps drawing up close until the new one replaces it
+	ApplyLODDistances(bHasFullMesh ? 0 : LODIndex);
+}
+
+void AIslandConstructor::TrimLODs(int32 NumCoarseLODs)
+{
+	while (LODComponents.Num() > NumCoarseLODs)
+	{
+		if (UDynamicMeshComponent* LODComponent = LODComponents.Pop())
+		{
+			LODComponent->DestroyComponent();
+		}
+	}
+}
+
+UDynamicMeshComponent* AIslandConstructor::CreateLODComponent(int32 LODIndex)
+{
+	UDynamicMeshComponent* RootMeshComponent = GetDynamicMeshComponent();
+
+	UDynamicMeshComponent* LODComponent = NewObject<UDynamicMeshComponent>(this, *FString::Printf(TEXT("IslandLOD_%d"), LODIndex));
+	LODComponent->SetupAttachment(RootMeshComponent);
+
+	// Draw only, collision and navigation stay on the full mesh
+	LODComponent->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+	LODComponent->SetCanEverAffectNavigation(false);
+
+	for (int32 MaterialIndex = 0; MaterialIndex < RootMeshComponent->GetNumMaterials(); ++MaterialIndex)
+	{
+		LODComponent->SetMaterial(MaterialIndex, RootMeshComponent->GetMaterial(MaterialIndex));
+	}
+
+	LODComponent->RegisterComponent();
+	return LODComponent;
+}
+
+float AIslandConstructor::GetLODStartDistance(int32 LODIndex) const
+{
+	return LODIndex <= 0 ? 0.0f : LODDistance * FMath::Pow(2.0f, (float)(LODIndex - 1));
+}
+
+void AIslandConstructor::ApplyLODDistances(int32 FinestReadyLOD)
+{
+	// Min and max draw distance are resolved per primitive by the renderer, nothing ticks to switch LODs
+	for (int32 LODIndex = 1; LODIndex <= LODComponents.Num(); ++LODIndex)
+	{
+		UDynamicMeshComponent* LODComponent = LODComponents[LODIndex - 1];
+		if (!LODComponent)
+		{
+			continue;
+		}
+
+		const bool bLast = LODIndex == LODComponents.Num();
+		LODComponent->SetVisibility(LODIndex >= FinestReadyLOD);
+		LODComponent->MinDrawDistance = LODIndex == FinestReadyLOD ? 0.0f : GetLODStartDistance(LODIndex);
+		LODComponent->SetCullDistance(bLast ? TileCullDistance : GetLODStartDistance(LODIndex + 1));
+		LODComponent->MarkRenderStateDirty();
+	}
+
+	GetDynamicMeshComponent()->SetCullDistance(LODComponents.Num() > 0 ? GetLODStartDistance(1) : 0.0f);
+	for (UDynamicMeshComponent* TileComponent : TileComponents)
+	{
+		if (TileComponent)
+		{
+			TileComponent->SetCullDistance(LODComponents.Num() > 0 ? GetLODStartDistance(1) : TileCullDistance);
+		}
+	}
+}
+
+void AIslandConstructor::FinalizeMeshes()
+{
+	// Only the full mesh collides, the LODs only draw
+	TArray<UStaticMeshComponent*> Baked;
+	int32 NumFailed = 0;
+	auto Bake = [this, &Baked, &NumFailed](UDynamicMeshComponent* Source, bool bWithCollision)
+	{
+		// Nothing to bake, e.g. a tile that is all water. Its dynamic component goes away with the rest below
+		if (!Source || Source->GetDynamicMesh()->GetTriangleCount() == 0)
+		{
+			return;
+		}
+
+		if (UStaticMeshComponent* Component = CreateFinalizedComponent(Source, bWithCollision))
+		{
+			Baked.Add(Component);
+		}
+		else
+		{
+			++NumFailed;
+		}
+	};
+
+	if (TileComponents.Num() > 0)
+	{
+		for (UDynamicMeshComponent* TileComponent : TileComponents)
+		{
+			Bake(TileComponent, true);
+		}
+	}
+	else
+	{
+		Bake(GetDynamicMeshComponent(), true);
+	}
+
+	for (UDynamicMeshComponent* LODComponent : LODComponents)
+	{
+		Bake(LODComponent, false);
+	}
+
+	if (Baked.Num() == 0 && NumFailed == 0)
+	{
+		UE_LOG(LogTemp, Log, TEXT("%s: nothing to finalize, the island mesh is empty"), *GetName());
+		return;
+	}
+
+	// Half a baked island is worse than none, keep drawing the dynamic meshes
+	if (NumFailed > 0)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("%s: finalizing to static meshes abandoned, %d of %d meshes failed to bake. Keeping the dynamic meshes"),
+			*GetName(), NumFailed, NumFailed + Baked.Num());
+		for (UStaticMeshComponent* Component : Baked)
+		{
+			Component->DestroyComponent();
+		}
+		return;
+	}
+
+	FinalizedComponents.Append(Baked);
+
+	// Nothing edits the island from here on, drop the topology, attribute overlays and the dynamic components' collision
+	ClearTiles();
+	TrimLODs(0);
+	DynamicMesh->Reset();
+	ReleaseAllComputeMeshes();
+}
+
+void AIslandConstructor::ClearFinalizedMeshes()
+{
+	for (UStaticMeshComponent* Component : FinalizedComponents)
+	{
+		if (Component)
+		{
+			Component->DestroyComponent();
+		}
+	}
+
+	FinalizedComponents.Empty();
+}
+
+UStaticMeshComponent* AIslandConstructor::CreateFinalizedComponent(UDynamicMeshComponent* Source, bool bWithCollision)
+{
+	TArray<UMaterialInterface*> Materials;
+	for (int32 MaterialIndex = 0; MaterialIndex < Source->GetNumMaterials(); ++MaterialIndex)
+	{
+		Materials.Add(Source->GetMaterial(MaterialIndex));
+	}
+
+	UStaticMesh* StaticMesh = nullptr;
+	Source->ProcessMesh([this, &StaticMesh, &Materials, bWithCollision](const FDynamicMesh3& Mesh)
+	{
+		StaticMesh = FIslandStaticMeshBaker::Bake(this, Mesh, Materials, bWithCollision);
+	});
+
+	if (!StaticMesh)
+	{
+		return nullptr;
+	}
+
+	UStaticMeshComponent* Component = NewObject<UStaticMeshComponent>(this, MakeUniqueObjectName(this, UStaticMeshComponent::StaticClass(), TEXT("IslandFinalized")));
+	Component->SetupAttachment(GetDynamicMeshComponent());
+	Component->SetMobility(Source->Mobility);
+	Component->SetStaticMesh(StaticMesh);
+
+	// Same collision the dynamic component had, whatever was set up on the root in the level
+	if (bWithCollision)
+	{
+		Component->SetCollisionProfileName(Source->GetCollisionProfileName());
+		Component->SetCollisionEnabled(Source->GetCollisionEnabled());
+	}
+	else
+	{
+		Component->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+		Component->SetCanEverAffectNavigation(false);
+	}
+
+	Component->SetVisibility(Source->IsVisible());
+	Component->MinDrawDistance = Source->MinDrawDistance;
+	Component->SetCullDistance(Source->CachedMaxDrawDistance);
+
+	Component->RegisterComponent();
+	return Component;
+}
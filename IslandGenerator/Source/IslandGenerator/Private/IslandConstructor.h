@@ -1,58 +1,300 @@
-// The source code, authored by Zoxemik in 2025
-
-#pragma once
-
-#include "CoreMinimal.h"
-#include "DynamicMeshActor.h"
-#include "IslandConstructor.generated.h"
-
-class ASpawnMarker;
-
-UCLASS()
-class AIslandConstructor : public ADynamicMeshActor
-{
-	GENERATED_BODY()
-	
-public:
-	AIslandConstructor();
-
-protected:
-	virtual void BeginPlay() override;
-
-	UFUNCTION()
-	void CreateIsland(bool SpawnMarkers);
-
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Default")
-	TSubclassOf<ASpawnMarker> SpawnMarkerBlueprint; // Always points to the center of the biome, useful for spawning objects in specific locations
-
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Default")
-	FRandomStream Seed;
-
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Default")
-	int32 MaxNumberOfIslands;
-
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Default")
-	float IslandRadius;
-
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Default")
-	float IslandHeight;
-
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Default")
-	float MaxSpawnDistance;
-
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Default")
-	FVector2D IslandSize;
-
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Default", meta = (ToolTip = "Used to set the final island mesh resolution, useful for optimization"))
-	int32 IslandGridResolution;
-
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Default", meta = (ToolTip = "Used to subdivide a surface into smaller polygons, useful for optimization"))
-	int32 IslandTessellationLevel;
-private:
-	UPROPERTY()
-	TObjectPtr<UDynamicMesh> DynamicMesh;
-
-	UPROPERTY()
-	TArray<FVector> SpawnPoints;
-
-};
+// The source code, authored by Zoxemik in 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "DynamicMeshActor.h"
+#include "IslandMeshBuilder.h"
+#include "IslandDescriptor.h"
+#include "IslandTerrainSample.h"
+#include "IslandConstructor.generated.h"
+
+class ASpawnMarker;
+class UStaticMeshComponent;
+class FIslandTerrainGrid;
+class AIslandConstructor;
+
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnIslandSurfaceReady, AIslandConstructor*);
+
+UCLASS()
+class AIslandConstructor : public ADynamicMeshActor
+{
+	GENERATED_BODY()
+	
+public:
+	AIslandConstructor();
+
+	// Cancels any build in flight and generates the island again from the current parameters
+	UFUNCTION(BlueprintCallable, Category = "Island Generator")
+	void RegenerateIsland();
+
+	UFUNCTION(BlueprintCallable, Category = "Island Generator")
+	void CancelGeneration();
+
+	// Generates from this seed instead of asking the GameInstance, call before BeginPlay (e.g. on a deferred spawn)
+	void SetSeed(const FRandomStream& InSeed);
+
+	UFUNCTION(BlueprintPure, Category = "Island Generator")
+	bool IsGenerating() const { return ActiveCancelFlag.IsValid() || ScheduledJobId != INDEX_NONE; }
+
+	// Per-stage timings, mesh sizes and peak memory of the last finished generation
+	UFUNCTION(BlueprintPure, Category = "Island Generator")
+	const FIslandGenerationStats& GetLastGenerationStats() const { return LastGenerationStats; }
+
+	// Every island of the current layout, in world space, available as soon as the layout is rolled
+	UFUNCTION(BlueprintPure, Category = "Island Generator")
+	const TArray<FIslandDescriptor>& GetIslands() const { return IslandDescriptors; }
+
+	// Island whose shore is closest to the location, distance 0 when the location is on it. False without islands
+	UFUNCTION(BlueprintCallable, Category = "Island Generator")
+	bool FindNearestIsland(const FVector& Location, FIslandDescriptor& OutIsland) const;
+
+	// Islands whose shore comes within Radius of the location, in XY
+	UFUNCTION(BlueprintCallable, Category = "Island Generator")
+	void FindIslandsInRadius(const FVector& Location, float Radius, TArray<FIslandDescriptor>& OutIslands) const;
+
+	// Island the location lies on in XY, the one with the nearest center where islands overlap
+	UFUNCTION(BlueprintCallable, Category = "Island Generator")
+	bool FindIslandAt(const FVector& Location, FIslandDescriptor& OutIsland) const;
+
+	// The island is drawn and collides through baked static meshes, the editable mesh is gone
+	UFUNCTION(BlueprintPure, Category = "Island Generator")
+	bool IsFinalized() const { return FinalizedComponents.Num() > 0; }
+
+	// Upward facing surface of the current mesh in actor space, null until the first generation finishes
+	TSharedPtr<const FIslandSurfaceSampler> GetSurfaceSampler() const { return SurfaceSampler; }
+
+	// Terrain query grid of the current mesh, null until the first generation finishes or with TerrainGridResolution 0.
+	// Take the pointer on the game thread, the grid itself can then be queried from any thread
+	TSharedPtr<const FIslandTerrainGrid> GetTerrainGrid() const { return TerrainGrid; }
+
+	// Height, normal, slope and island at the world XY of every location, Z is ignored
+	UFUNCTION(BlueprintCallable, Category = "Island Generator|Terrain")
+	void QueryTerrain(const TArray<FVector>& Locations, TArray<FIslandTerrainSample>& OutSamples) const;
+
+	UFUNCTION(BlueprintCallable, Category = "Island Generator|Terrain")
+	bool GetTerrainSample(const FVector& Location, FIslandTerrainSample& OutSample) const;
+
+	UFUNCTION(BlueprintCallable, Category = "Island Generator|Terrain")
+	bool GetTerrainHeight(const FVector& Location, float& OutHeight) const;
+
+	UFUNCTION(BlueprintCallable, Category = "Island Generator|Terrain")
+	bool GetTerrainNormal(const FVector& Location, FVector& OutNormal) const;
+
+	// Angle between the surface and the horizontal, in degrees
+	UFUNCTION(BlueprintCallable, Category = "Island Generator|Terrain")
+	bool GetTerrainSlope(const FVector& Location, float& OutSlopeAngle) const;
+
+	UFUNCTION(BlueprintPure, Category = "Island Generator|Terrain")
+	bool IsLandAt(const FVector& Location) const;
+
+	// Biome of the ground at the world XY of the location, false over water
+	UFUNCTION(BlueprintCallable, Category = "Island Generator|Terrain")
+	bool GetBiomeAt(const FVector& Location, EIslandBiome& OutBiome) const;
+
+	// Broadcast whenever a finished generation publishes a new surface, before the GameMode is notified
+	FOnIslandSurfaceReady OnSurfaceReady;
+
+protected:
+	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+
+	UFUNCTION()
+	void CreateIsland(bool SpawnMarkers);
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Default")
+	TSubclassOf<ASpawnMarker> SpawnMarkerBlueprint; // Always points to the center of the biome, useful for spawning objects in specific locations
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Default", meta = (ToolTip = "Spawns a SpawnMarkerBlueprint actor on every island. Gameplay can read GetIslands and the Find queries instead, then disable this to skip the actors"))
+	bool bSpawnMarkerActors;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Default")
+	FRandomStream Seed;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Default")
+	int32 MaxNumberOfIslands;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Default")
+	float IslandRadius;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Default")
+	float IslandHeight;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Default")
+	float MaxSpawnDistance;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Default")
+	FVector2D IslandSize;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Default", meta = (ToolTip = "Used to set the final island mesh resolution, useful for optimization"))
+	int32 IslandGridResolution;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Default", meta = (ToolTip = "Used to subdivide a surface into smaller polygons, useful for optimization"))
+	int32 IslandTessellationLevel;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Default", meta = (ToolTip = "Uniform PN tessellates every triangle, Adaptive only splits cliffs and coast where the surface is curved and leaves flat plateaus coarse. Not used by the Heightfield method"))
+	EIslandTessellationMode TessellationMode;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Default", meta = (ClampMin = "0", ToolTip = "Hard cap on the triangle count after tessellation, 0 means no limit"))
+	int32 TessellationTriangleBudget;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Default", meta = (ClampMin = "0", EditCondition = "TessellationMode == EIslandTessellationMode::Adaptive", ToolTip = "How far, in world units, the flat mesh may stray from the curved surface before an edge is split"))
+	float TessellationMaxError;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Default", meta = (ToolTip = "VoxelSolidify voxelizes the cone triangle soup, ImplicitSDF meshes the analytic cones directly and is much cheaper at high resolutions, Heightfield only builds the top surface and cliffs and is the fastest"))
+	EIslandMeshingMethod MeshingMethod;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Default", meta = (EditCondition = "MeshingMethod == EIslandMeshingMethod::ImplicitSDF", ToolTip = "How far islands blend into each other and into the base, in world units"))
+	float ImplicitBlendRadius;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Default", meta = (EditCondition = "MeshingMethod == EIslandMeshingMethod::ImplicitSDF", ToolTip = "Also run the smoothing and plane cut stages on the implicit mesh"))
+	bool bPostProcessImplicitMesh;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Pipeline", meta = (ClampMin = "0", ToolTip = "Smoothing passes after meshing, each one softens cliffs and shrinks sharp features a little"))
+	int32 SmoothingIterations;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Pipeline", meta = (ClampMin = "0", ClampMax = "1", ToolTip = "How far every smoothing pass moves a vertex towards the average of its neighbours"))
+	float SmoothingAlpha;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Pipeline", meta = (ClampMin = "1", ToolTip = "World units per UV tile of the planar projection"))
+	float UVScale;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Layout", meta = (ToolTip = "CullContained drops islands that sit fully inside a bigger one, Separate also drops any touching a bigger one. Dropped islands are never meshed and get no marker"))
+	EIslandOverlapMode OverlapMode;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Layout", meta = (ClampMin = "0", ClampMax = "1", ToolTip = "Share of the spawn area that should be land, islands past it are dropped biggest first. 0 keeps every island"))
+	float TargetLandCoverage;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Tiling", meta = (ClampMin = "1", ToolTip = "Splits the area islands can spawn in, MaxSpawnDistance around the constructor, into a grid of tiles, each with its own component and collision. 1x1 keeps a single mesh"))
+	FIntPoint TileGridSize;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Tiling", meta = (ClampMin = "0", ToolTip = "Max draw distance of every tile, 0 disables distance culling"))
+	float TileCullDistance;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "LOD", meta = (ClampMin = "1", ClampMax = "6", ToolTip = "Number of LODs including the full mesh. Coarser LODs are generated first and drawn while the finer ones are still building"))
+	int32 NumLODs;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "LOD", meta = (ClampMin = "0", ToolTip = "Distance LOD 1 takes over from the full mesh, every further LOD takes over at twice the distance of the previous one"))
+	float LODDistance;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "LOD", meta = (ClampMin = "0.05", ClampMax = "1", ToolTip = "IslandGridResolution multiplier from one LOD to the next"))
+	float LODResolutionScale;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Cache", meta = (ToolTip = "Stores finished meshes under Saved/IslandCache keyed by seed and parameters, later loads with the same key skip generation"))
+	bool bUseMeshCache;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Cache", meta = (ClampMin = "0", EditCondition = "bUseMeshCache", ToolTip = "Least recently used entries are evicted above this size, 0 means unlimited"))
+	int32 MaxMeshCacheSizeMB;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Cache", meta = (ToolTip = "Keeps the mesh after every pipeline stage in memory, so changing a late stage parameter such as UVScale only reruns the stages after the change"))
+	bool bUseStageCache;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Cache", meta = (ClampMin = "0", EditCondition = "bUseStageCache", ToolTip = "Memory kept for stage meshes across every island, least recently used ones are dropped above it. 0 means unlimited"))
+	int32 MaxStageCacheSizeMB;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Terrain", meta = (ClampMin = "0", ToolTip = "Cells of the terrain query grid along the longer side of the island, see QueryTerrain. 0 skips building it"))
+	int32 TerrainGridResolution;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Terrain", meta = (ToolTip = "How the terrain grid sorts land into biomes, see GetBiomeAt and the spawner's BiomeWeights"))
+	FIslandBiomeRules BiomeRules;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Finalize", meta = (ToolTip = "Once generation finishes, bakes the island into runtime static meshes with packed vertex formats and cooked collision, then releases the editable mesh. Regenerating starts from scratch"))
+	bool bFinalizeToStaticMesh;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Default", meta = (ToolTip = "Builds the island mesh on a worker thread and swaps it in when finished, instead of stalling the game thread"))
+	bool bAsyncGeneration;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Server", meta = (ToolTip = "On a dedicated server skip what only rendering needs: normals, UVs and extra LODs. The geometry stays the same as on clients"))
+	bool bCollisionOnlyOnServer;
+
+private:
+	FIslandGenerationSettings MakeGenerationSettings() const;
+
+	bool UseServerProfile() const;
+
+	void LaunchAsyncBuild(const FIslandGenerationSettings& Settings, TArray<FIslandShape> Islands);
+
+	// Hands the build's slot back to the world's generation scheduler
+	void ReleaseScheduledJob(bool bCompleted);
+
+	// Swaps the finished mesh into the component(s) and notifies the GameMode, game thread only
+	void FinishGeneration(FIslandBuildResult&& Result);
+
+	void PublishTiles(TArray<FIslandMeshTile>& Tiles);
+
+	void ClearTiles();
+
+	UDynamicMeshComponent* CreateTileComponent(int32 TileIndex);
+
+	// Swaps a coarse LOD into its component, game thread only
+	void PublishLOD(int32 LODIndex, UE::Geometry::FDynamicMesh3&& Mesh);
+
+	// Destroys LOD components beyond the chain the current settings ask for
+	void TrimLODs(int32 NumCoarseLODs);
+
+	UDynamicMeshComponent* CreateLODComponent(int32 LODIndex);
+
+	// Draw distance ranges of the whole chain. Until the full mesh exists the finest LOD built so far is drawn at every distance
+	void ApplyLODDistances(int32 FinestReadyLOD);
+
+	float GetLODStartDistance(int32 LODIndex) const;
+
+	// Replaces every dynamic mesh component's mesh with a baked static one and frees the dynamic meshes, game thread only
+	void FinalizeMeshes();
+
+	void ClearFinalizedMeshes();
+
+	// Static mesh component drawing what Source draws, at the same distances
+	UStaticMeshComponent* CreateFinalizedComponent(UDynamicMeshComponent* Source, bool bWithCollision);
+
+	UPROPERTY()
+	TObjectPtr<UDynamicMesh> DynamicMesh;
+
+	UPROPERTY()
+	TArray<FIslandDescriptor> IslandDescriptors;
+
+	// Set by the in-flight async build, flipping it makes the worker bail out at the next stage
+	TSharedPtr<FThreadSafeBool> ActiveCancelFlag;
+
+	// Bumped on every build so a stale result can never overwrite a newer one
+	int32 GenerationSerial;
+
+	// Job of the current build in the world's generation scheduler, INDEX_NONE when there is none
+	int32 ScheduledJobId;
+
+	UPROPERTY()
+	TArray<TObjectPtr<ASpawnMarker>> SpawnedMarkers;
+
+	UPROPERTY()
+	TArray<TObjectPtr<UDynamicMeshComponent>> TileComponents;
+
+	// Hash of the mesh currently in each tile component
+	TArray<uint32> TileHashes;
+
+	// LOD 1 onwards, LOD 0 is the root component or the tiles
+	UPROPERTY()
+	TArray<TObjectPtr<UDynamicMeshComponent>> LODComponents;
+
+	bool bHasFullMesh;
+
+	// Root or tiles first, then the LODs, only filled when the island is finalized
+	UPROPERTY()
+	TArray<TObjectPtr<UStaticMeshComponent>> FinalizedComponents;
+
+	UPROPERTY()
+	FIslandGenerationStats LastGenerationStats;
+
+	TSharedPtr<const FIslandSurfaceSampler> SurfaceSampler;
+
+	TSharedPtr<const FIslandTerrainGrid> TerrainGrid;
+
+	bool bLastSpawnMarkers;
+
+	bool bSeedFromGameInstance;
+
+	bool bAppliedZOffset;
+};
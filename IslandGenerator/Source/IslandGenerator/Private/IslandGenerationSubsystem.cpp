@@ -0,0 +1,272 @@
+// The source code, authored by Zoxemik in 2025
+
+#include "IslandGenerationSubsystem.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "TimerManager.h"
+
+UIslandGenerationSubsystem::UIslandGenerationSubsystem()
+{
+	MaxConcurrentGenerationJobs = 2;
+
+	MaxConcurrentSpawnJobs = 1;
+
+	MaxInFlightMemoryMB = 2048;
+
+	JobTimeoutSeconds = 120.0f;
+
+	InFlightMemoryBytes = 0;
+
+	NextJobId = 0;
+
+	bDispatchPending = false;
+}
+
+bool UIslandGenerationSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	// Editor worlds have no play to schedule around, constructors there build straight away
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+int32 UIslandGenerationSubsystem::QueueJob(AActor* Owner, EIslandJobType Type, const FVector& Location, int64 EstimatedMemoryBytes, TFunction<void()>&& Start)
+{
+	FIslandScheduledJob& Job = QueuedJobs.AddDefaulted_GetRef();
+	Job.Info.JobId = NextJobId++;
+	Job.Info.Type = Type;
+	Job.Info.Owner = Owner;
+	Job.Location = Location;
+	Job.MemoryBytes = FMath::Max<int64>(EstimatedMemoryBytes, 0);
+	Job.QueueTime = FPlatformTime::Seconds();
+	Job.Start = MoveTemp(Start);
+
+	const int32 JobId = Job.Info.JobId;
+	RequestDispatch();
+	return JobId;
+}
+
+void UIslandGenerationSubsystem::CompleteJob(int32 JobId)
+{
+	FinishJob(JobId, true);
+}
+
+void UIslandGenerationSubsystem::CancelJob(int32 JobId)
+{
+	FinishJob(JobId, false);
+}
+
+void UIslandGenerationSubsystem::FinishJob(int32 JobId, bool bCompleted)
+{
+	const int32 RunningIndex = RunningJobs.IndexOfByPredicate([JobId](const FIslandScheduledJob& Job) { return Job.Info.JobId == JobId; });
+	if (RunningIndex == INDEX_NONE)
+	{
+		// Never started, nothing to free
+		QueuedJobs.RemoveAll([JobId](const FIslandScheduledJob& Job) { return Job.Info.JobId == JobId; });
+		return;
+	}
+
+	FIslandScheduledJob Job = MoveTemp(RunningJobs[RunningIndex]);
+	RunningJobs.RemoveAtSwap(RunningIndex);
+	InFlightMemoryBytes -= Job.MemoryBytes;
+
+	RequestDispatch();
+
+	if (!bCompleted)
+	{
+		return;
+	}
+
+	Job.Info.RunTimeMs = (float)((FPlatformTime::Seconds() - Job.StartTime) * 1000.0);
+	OnJobComplete.Broadcast(Job.Info);
+
+	BroadcastIfIdle();
+}
+
+void UIslandGenerationSubsystem::BroadcastIfIdle()
+{
+	if (IsIdle())
+	{
+		UE_LOG(LogTemp, Log, TEXT("Island generation scheduler idle, every queued job is complete"));
+		OnWorldGenerationComplete.Broadcast();
+	}
+}
+
+bool UIslandGenerationSubsystem::ReleaseStaleJobs()
+{
+	// Owners destroyed without cancelling, e.g. by a sublevel unload, never report back, and neither does a stuck one,
+	// e.g. a NavMesh spawner in a level without a navmesh
+	const double Now = FPlatformTime::Seconds();
+	int32 NumReleased = 0;
+	for (int32 RunningIndex = RunningJobs.Num() - 1; RunningIndex >= 0; --RunningIndex)
+	{
+		const FIslandScheduledJob& Job = RunningJobs[RunningIndex];
+		const bool bOwnerGone = !Job.Info.Owner.IsValid();
+		if (!bOwnerGone && (JobTimeoutSeconds <= 0.0f || Now - Job.StartTime < JobTimeoutSeconds))
+		{
+			continue;
+		}
+
+		if (bOwnerGone)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("Island %s job %d released, its owner was destroyed before completing it"), *UEnum::GetValueAsString(Job.Info.Type), Job.Info.JobId);
+		}
+		else
+		{
+			UE_LOG(LogTemp, Warning, TEXT("Island %s job %d of %s released, it ran longer than JobTimeoutSeconds (%.0f s)"), *UEnum::GetValueAsString(Job.Info.Type), Job.Info.JobId, *Job.Info.Owner->GetName(), JobTimeoutSeconds);
+		}
+
+		InFlightMemoryBytes -= Job.MemoryBytes;
+		RunningJobs.RemoveAtSwap(RunningIndex);
+		++NumReleased;
+	}
+	NumReleased += QueuedJobs.RemoveAll([](const FIslandScheduledJob& Job) { return !Job.Info.Owner.IsValid(); });
+
+	// Released jobs never complete, so without this the world would never report being done
+	if (NumReleased > 0)
+	{
+		BroadcastIfIdle();
+	}
+	return NumReleased > 0;
+}
+
+void UIslandGenerationSubsystem::CheckRunningJobs()
+{
+	if (ReleaseStaleJobs())
+	{
+		RequestDispatch();
+	}
+
+	UWorld* World = GetWorld();
+	if (RunningJobs.Num() == 0 && World)
+	{
+		World->GetTimerManager().ClearTimer(RunningCheckHandle);
+	}
+}
+
+void UIslandGenerationSubsystem::RequestDispatch()
+{
+	UWorld* World = GetWorld();
+	if (bDispatchPending || !World)
+	{
+		return;
+	}
+
+	bDispatchPending = true;
+	World->GetTimerManager().SetTimerForNextTick(this, &UIslandGenerationSubsystem::Dispatch);
+}
+
+void UIslandGenerationSubsystem::GetViewLocations(TArray<FVector>& OutLocations) const
+{
+	OutLocations.Reset();
+	for (FConstPlayerControllerIterator It = GetWorld()->GetPlayerControllerIterator(); It; ++It)
+	{
+		APlayerController* PlayerController = It->Get();
+		if (PlayerController && PlayerController->IsLocalController())
+		{
+			FVector ViewLocation;
+			FRotator ViewRotation;
+			PlayerController->GetPlayerViewPoint(ViewLocation, ViewRotation);
+			OutLocations.Add(ViewLocation);
+		}
+	}
+}
+
+void UIslandGenerationSubsystem::Dispatch()
+{
+	bDispatchPending = false;
+
+	ReleaseStaleJobs();
+
+	if (QueuedJobs.Num() == 0)
+	{
+		return;
+	}
+
+	// Nearest to any local player first, queue order among equals and when there are no players
+	TArray<FVector> ViewLocations;
+	GetViewLocations(ViewLocations);
+
+	TArray<TPair<double, int32>> Order;
+	Order.Reserve(QueuedJobs.Num());
+	for (int32 QueuedIndex = 0; QueuedIndex < QueuedJobs.Num(); ++QueuedIndex)
+	{
+		double DistanceSquared = ViewLocations.Num() > 0 ? TNumericLimits<double>::Max() : 0.0;
+		for (const FVector& ViewLocation : ViewLocations)
+		{
+			DistanceSquared = FMath::Min(DistanceSquared, FVector::DistSquared(ViewLocation, QueuedJobs[QueuedIndex].Location));
+		}
+		Order.Emplace(DistanceSquared, QueuedIndex);
+	}
+	Order.StableSort([](const TPair<double, int32>& A, const TPair<double, int32>& B) { return A.Key < B.Key; });
+
+	int32 RunningCounts[2] = { 0, 0 };
+	for (const FIslandScheduledJob& Job : RunningJobs)
+	{
+		++RunningCounts[(int32)Job.Info.Type];
+	}
+	const int32 MaxCounts[2] = { FMath::Max(MaxConcurrentGenerationJobs, 1), FMath::Max(MaxConcurrentSpawnJobs, 1) };
+	const int64 MaxMemoryBytes = (int64)MaxInFlightMemoryMB * 1024 * 1024;
+
+	// A job that does not fit the memory cap holds back every job of its type behind it, so big islands can't starve
+	bool bTypeBlocked[2] = { false, false };
+
+	const double Now = FPlatformTime::Seconds();
+	TArray<int32> StartedIndices;
+	for (const TPair<double, int32>& Entry : Order)
+	{
+		FIslandScheduledJob& Job = QueuedJobs[Entry.Value];
+		const int32 TypeIndex = (int32)Job.Info.Type;
+		if (bTypeBlocked[TypeIndex] || RunningCounts[TypeIndex] >= MaxCounts[TypeIndex])
+		{
+			continue;
+		}
+
+		// One job always runs, however big its estimate
+		const bool bFitsMemory = MaxInFlightMemoryMB <= 0 || InFlightMemoryBytes == 0 || InFlightMemoryBytes + Job.MemoryBytes <= MaxMemoryBytes;
+		if (!bFitsMemory)
+		{
+			bTypeBlocked[TypeIndex] = true;
+			continue;
+		}
+
+		++RunningCounts[TypeIndex];
+		InFlightMemoryBytes += Job.MemoryBytes;
+		Job.StartTime = Now;
+		Job.Info.WaitTimeMs = (float)((Now - Job.QueueTime) * 1000.0);
+		StartedIndices.Add(Entry.Value);
+	}
+
+	if (StartedIndices.Num() == 0)
+	{
+		return;
+	}
+
+	// Move every started job over before running any Start, which may complete or cancel its job right away
+	TArray<TFunction<void()>> StartFunctions;
+	for (int32 QueuedIndex : StartedIndices)
+	{
+		FIslandScheduledJob& Job = QueuedJobs[QueuedIndex];
+		StartFunctions.Add(MoveTemp(Job.Start));
+		RunningJobs.Add(MoveTemp(Job));
+	}
+
+	StartedIndices.Sort(TGreater<int32>());
+	for (int32 QueuedIndex : StartedIndices)
+	{
+		QueuedJobs.RemoveAt(QueuedIndex);
+	}
+
+	FTimerManager& TimerManager = GetWorld()->GetTimerManager();
+	if (!TimerManager.IsTimerActive(RunningCheckHandle))
+	{
+		TimerManager.SetTimer(RunningCheckHandle, this, &UIslandGenerationSubsystem::CheckRunningJobs, 1.0f, true);
+	}
+
+	// Nearest first
+	for (TFunction<void()>& Start : StartFunctions)
+	{
+		if (Start)
+		{
+			Start();
+		}
+	}
+}
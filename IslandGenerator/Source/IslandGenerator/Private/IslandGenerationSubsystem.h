@@ -0,0 +1,113 @@
+// The source code, authored by Zoxemik in 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Engine/EngineTypes.h"
+#include "IslandJobInfo.h"
+#include "IslandGenerationSubsystem.generated.h"
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnIslandJobComplete, const FIslandJobInfo&, Job);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnIslandWorldGenerationComplete);
+
+// One job waiting for, or holding, a scheduler slot
+struct FIslandScheduledJob
+{
+	FIslandJobInfo Info;
+
+	FVector Location = FVector::ZeroVector;
+
+	int64 MemoryBytes = 0;
+
+	double QueueTime = 0.0;
+
+	double StartTime = 0.0;
+
+	TFunction<void()> Start;
+};
+
+// Queues the generation and spawning jobs of every island constructor and spawner in the world, and starts them a few
+// at a time, nearest to a local player first, so islands streaming in together don't stack their work in the same frames.
+// The limits are read from [/Script/IslandGenerator.IslandGenerationSubsystem] in DefaultGame.ini
+UCLASS(Config = Game)
+class UIslandGenerationSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	UIslandGenerationSubsystem();
+
+	// Queues a job, Start runs on the game thread once a slot is free. The owner reports the end of the job with
+	// CompleteJob, or CancelJob if it gave up, to free the slot. Returns the job id
+	int32 QueueJob(AActor* Owner, EIslandJobType Type, const FVector& Location, int64 EstimatedMemoryBytes, TFunction<void()>&& Start);
+
+	// Frees the job's slot and broadcasts OnJobComplete, then OnWorldGenerationComplete if nothing else is left
+	void CompleteJob(int32 JobId);
+
+	// Drops a queued job, or frees the slot of a running one, without any completion event
+	void CancelJob(int32 JobId);
+
+	UFUNCTION(BlueprintPure, Category = "Island Generator")
+	int32 GetNumQueuedJobs() const { return QueuedJobs.Num(); }
+
+	UFUNCTION(BlueprintPure, Category = "Island Generator")
+	int32 GetNumRunningJobs() const { return RunningJobs.Num(); }
+
+	UFUNCTION(BlueprintPure, Category = "Island Generator")
+	bool IsIdle() const { return QueuedJobs.Num() == 0 && RunningJobs.Num() == 0; }
+
+	UPROPERTY(BlueprintAssignable, Category = "Island Generator")
+	FOnIslandJobComplete OnJobComplete;
+
+	// Broadcast every time the last queued or running job in the world completes
+	UPROPERTY(BlueprintAssignable, Category = "Island Generator")
+	FOnIslandWorldGenerationComplete OnWorldGenerationComplete;
+
+	UPROPERTY(Config, BlueprintReadWrite, Category = "Island Generator", meta = (ClampMin = "1", ToolTip = "Island meshes built on worker threads at once"))
+	int32 MaxConcurrentGenerationJobs;
+
+	UPROPERTY(Config, BlueprintReadWrite, Category = "Island Generator", meta = (ClampMin = "1", ToolTip = "Spawners loading and spawning at once, each one already spreads its actors over frames"))
+	int32 MaxConcurrentSpawnJobs;
+
+	UPROPERTY(Config, BlueprintReadWrite, Category = "Island Generator", meta = (ClampMin = "0", ToolTip = "Estimated peak memory of every running job together, a job that would go past it waits. One job always runs. 0 means unlimited"))
+	int32 MaxInFlightMemoryMB;
+
+	UPROPERTY(Config, BlueprintReadWrite, Category = "Island Generator", meta = (ClampMin = "0", ToolTip = "A running job that has not reported back after this many seconds gives up its slot, so a stuck spawner can't hold back every other one. 0 waits forever"))
+	float JobTimeoutSeconds;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	// Jobs are only started from a timer, so every actor that begins play in the same frame is queued before any starts
+	void RequestDispatch();
+
+	void Dispatch();
+
+	void FinishJob(int32 JobId, bool bCompleted);
+
+	// Frees the slots of running jobs whose owner is gone or that ran past JobTimeoutSeconds, and drops queued jobs
+	// whose owner is gone. Returns whether any job was released
+	bool ReleaseStaleJobs();
+
+	// Runs every second while jobs are running, the owners of stale jobs never call back to trigger a dispatch
+	void CheckRunningJobs();
+
+	void BroadcastIfIdle();
+
+	// View locations of every local player, empty on a dedicated server
+	void GetViewLocations(TArray<FVector>& OutLocations) const;
+
+	TArray<FIslandScheduledJob> QueuedJobs;
+
+	TArray<FIslandScheduledJob> RunningJobs;
+
+	int64 InFlightMemoryBytes;
+
+	int32 NextJobId;
+
+	bool bDispatchPending;
+
+	FTimerHandle RunningCheckHandle;
+};
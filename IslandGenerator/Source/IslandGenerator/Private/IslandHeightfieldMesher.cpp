@@ -0,0 +1,198 @@
+// The source code, authored by Zoxemik in 2025
+
+#include "IslandHeightfieldMesher.h"
+#include "Async/ParallelFor.h"
+
+using namespace UE::Geometry;
+
+namespace IslandHeightfield
+{
+	// Raw height of open water, the base of every cone
+	static constexpr float WaterHeight = -800.f;
+
+	// Cells of padding around the island footprints, keeps the blur kernel inside the grid
+	static constexpr int32 Padding = 4;
+}
+
+FIslandHeightfieldMesher::FIslandHeightfieldMesher(const TArray<FIslandShape>& InIslands)
+	: Islands(InIslands)
+{
+}
+
+bool FIslandHeightfieldMesher::IsCancelled() const
+{
+	return CancelF && CancelF();
+}
+
+void FIslandHeightfieldMesher::RasterizeCones(TArray<float>& Heights, const FVector2d& Origin, int32 NumX, int32 NumY, int32 Stride) const
+{
+	ParallelFor(NumY, [&](int32 Y)
+	{
+		float* Row = &Heights[Y * Stride];
+		const float RowY = (float)(Origin.Y + Y * CellSize);
+		const VectorRegister4Float LaneOffsets = MakeVectorRegisterFloat(0.0f, 1.0f, 2.0f, 3.0f);
+		const VectorRegister4Float Cell = VectorSetFloat1((float)CellSize);
+
+		for (const FIslandShape& Island : Islands)
+		{
+			const float DeltaY = RowY - (float)Island.Center.Y;
+			if (FMath::Abs(DeltaY) >= Island.Radius)
+			{
+				continue;
+			}
+
+			// Cone profile: the base radius sits at WaterHeight and it rises linearly to the top radius, a quarter of the base
+			const float Slope = Island.Height / (Island.Radius * 0.75f);
+			const VectorRegister4Float DeltaY2 = VectorSetFloat1(DeltaY * DeltaY);
+			const VectorRegister4Float Radius = VectorSetFloat1(Island.Radius);
+			const VectorRegister4Float SlopeV = VectorSetFloat1(Slope);
+			const VectorRegister4Float Base = VectorSetFloat1(IslandHeightfield::WaterHeight);
+			const VectorRegister4Float Top = VectorSetFloat1(IslandHeightfield::WaterHeight + Island.Height);
+
+			// Columns the cone covers, widened to whole vectors; the row stride is a multiple of four so this never overruns
+			const int32 FirstX = FMath::Max(FMath::FloorToInt32((Island.Center.X - Island.Radius - Origin.X) / CellSize), 0) & ~3;
+			const int32 LastX = FMath::Min(FMath::CeilToInt32((Island.Center.X + Island.Radius - Origin.X) / CellSize) + 1, Stride);
+
+			for (int32 X = FirstX; X < LastX; X += 4)
+			{
+				const VectorRegister4Float ColumnX = VectorMultiplyAdd(VectorAdd(VectorSetFloat1((float)X), LaneOffsets), Cell, VectorSetFloat1((float)(Origin.X - Island.Center.X)));
+				const VectorRegister4Float Distance = VectorSqrt(VectorMultiplyAdd(ColumnX, ColumnX, DeltaY2));
+
+				VectorRegister4Float Height = VectorMultiplyAdd(VectorSubtract(Radius, Distance), SlopeV, Base);
+				Height = VectorMax(VectorMin(Height, Top), Base);
+
+				VectorStore(VectorMax(VectorLoad(Row + X), Height), Row + X);
+			}
+		}
+	});
+}
+
+void FIslandHeightfieldMesher::Blur(TArray<float>& Heights, int32 NumX, int32 NumY, int32 Stride) const
+{
+	TArray<float> Scratch = Heights;
+
+	const VectorRegister4Float One = VectorSetFloat1(1.0f / 16.0f);
+	const VectorRegister4Float Four = VectorSetFloat1(4.0f / 16.0f);
+	const VectorRegister4Float Six = VectorSetFloat1(6.0f / 16.0f);
+
+	for (int32 Pass = 0; Pass < BlurPasses; ++Pass)
+	{
+		// Horizontal: Heights -> Scratch
+		ParallelFor(NumY, [&](int32 Y)
+		{
+			const float* Src = &Heights[Y * Stride];
+			float* Dst = &Scratch[Y * Stride];
+
+			int32 X = 2;
+			for (; X + 3 <= NumX - 3; X += 4)
+			{
+				VectorRegister4Float Sum = VectorMultiply(VectorLoad(Src + X), Six);
+				Sum = VectorMultiplyAdd(VectorAdd(VectorLoad(Src + X - 1), VectorLoad(Src + X + 1)), Four, Sum);
+				Sum = VectorMultiplyAdd(VectorAdd(VectorLoad(Src + X - 2), VectorLoad(Src + X + 2)), One, Sum);
+				VectorStore(Sum, Dst + X);
+			}
+			for (; X <= NumX - 3; ++X)
+			{
+				Dst[X] = (Src[X - 2] + 4.0f * Src[X - 1] + 6.0f * Src[X] + 4.0f * Src[X + 1] + Src[X + 2]) / 16.0f;
+			}
+		});
+
+		// Vertical: Scratch -> Heights, rows are contiguous so every load is a straight vector load
+		ParallelFor(NumY, [&](int32 Y)
+		{
+			float* Dst = &Heights[Y * Stride];
+			if (Y < 2 || Y > NumY - 3)
+			{
+				FMemory::Memcpy(Dst, &Scratch[Y * Stride], Stride * sizeof(float));
+				return;
+			}
+
+			const float* Up2 = &Scratch[(Y - 2) * Stride];
+			const float* Up1 = &Scratch[(Y - 1) * Stride];
+			const float* Mid = &Scratch[Y * Stride];
+			const float* Down1 = &Scratch[(Y + 1) * Stride];
+			const float* Down2 = &Scratch[(Y + 2) * Stride];
+
+			for (int32 X = 0; X < Stride; X += 4)
+			{
+				VectorRegister4Float Sum = VectorMultiply(VectorLoad(Mid + X), Six);
+				Sum = VectorMultiplyAdd(VectorAdd(VectorLoad(Up1 + X), VectorLoad(Down1 + X)), Four, Sum);
+				Sum = VectorMultiplyAdd(VectorAdd(VectorLoad(Up2 + X), VectorLoad(Down2 + X)), One, Sum);
+				VectorStore(Sum, Dst + X);
+			}
+		});
+	}
+}
+
+bool FIslandHeightfieldMesher::Generate(FDynamicMesh3& OutMesh) const
+{
+	OutMesh.Clear();
+	if (Islands.Num() == 0 || CellSize <= 0.0)
+	{
+		return !IsCancelled();
+	}
+
+	// Grid over the union of the cone footprints
+	FAxisAlignedBox2d Footprint = FAxisAlignedBox2d::Empty();
+	for (const FIslandShape& Island : Islands)
+	{
+		Footprint.Contain(FVector2d(Island.Center.X - Island.Radius, Island.Center.Y - Island.Radius));
+		Footprint.Contain(FVector2d(Island.Center.X + Island.Radius, Island.Center.Y + Island.Radius));
+	}
+
+	const double PaddingSize = IslandHeightfield::Padding * CellSize;
+	const FVector2d Origin = Footprint.Min - FVector2d(PaddingSize, PaddingSize);
+	const int32 NumX = FMath::CeilToInt32((Footprint.Width() + 2.0 * PaddingSize) / CellSize) + 1;
+	const int32 NumY = FMath::CeilToInt32((Footprint.Height() + 2.0 * PaddingSize) / CellSize) + 1;
+	const int32 Stride = Align(NumX, 4);
+
+	TArray<float> Heights;
+	Heights.Init(IslandHeightfield::WaterHeight, Stride * NumY);
+
+	RasterizeCones(Heights, Origin, NumX, NumY, Stride);
+	if (IsCancelled()) { return false; }
+
+	Blur(Heights, NumX, NumY, Stride);
+	if (IsCancelled()) { return false; }
+
+	// Triangulate only cells that reach above the bottom cut, that is the top plateau and the cliffs down to it
+	TArray<int32> SampleVertex;
+	SampleVertex.Init(INDEX_NONE, NumX * NumY);
+
+	auto GetVertex = [&](int32 X, int32 Y)
+	{
+		int32& VertexID = SampleVertex[X + Y * NumX];
+		if (VertexID == INDEX_NONE)
+		{
+			const float Height = FMath::Clamp(Heights[X + Y * Stride], MinZ, MaxZ);
+			VertexID = OutMesh.AppendVertex(FVector3d(Origin.X + X * CellSize, Origin.Y + Y * CellSize, Height));
+		}
+		return VertexID;
+	};
+
+	for (int32 Y = 0; Y < NumY - 1; ++Y)
+	{
+		for (int32 X = 0; X < NumX - 1; ++X)
+		{
+			const float H00 = Heights[X + Y * Stride];
+			const float H10 = Heights[X + 1 + Y * Stride];
+			const float H01 = Heights[X + (Y + 1) * Stride];
+			const float H11 = Heights[X + 1 + (Y + 1) * Stride];
+			if (FMath::Max(FMath::Max(H00, H10), FMath::Max(H01, H11)) <= MinZ)
+			{
+				continue;
+			}
+
+			const int32 V00 = GetVertex(X, Y);
+			const int32 V10 = GetVertex(X + 1, Y);
+			const int32 V01 = GetVertex(X, Y + 1);
+			const int32 V11 = GetVertex(X + 1, Y + 1);
+
+			// Clockwise seen from above, which faces up in the engine's left-handed winding
+			OutMesh.AppendTriangle(V00, V11, V10);
+			OutMesh.AppendTriangle(V00, V01, V11);
+		}
+	}
+
+	return !IsCancelled();
+}
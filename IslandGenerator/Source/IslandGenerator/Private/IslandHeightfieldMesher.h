@@ -0,0 +1,40 @@
+// The source code, authored by Zoxemik in 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "DynamicMesh/DynamicMesh3.h"
+#include "IslandMeshBuilder.h"
+
+// 2.5D island mesher. The plane cuts leave a flat top and an open bottom, so the only surface that survives the
+// volumetric pipeline is a heightfield; this builds that heightfield directly and triangulates it
+class FIslandHeightfieldMesher
+{
+public:
+	FIslandHeightfieldMesher(const TArray<FIslandShape>& InIslands);
+
+	// Spacing of the height grid in world units
+	double CellSize = 100.0;
+
+	// Number of separable blur passes softening the cone edges and the seams between islands
+	int32 BlurPasses = 2;
+
+	// Heights are clamped to this band, matching the bottom and top plane cuts
+	float MinZ = -390.f;
+	float MaxZ = 0.f;
+
+	TFunction<bool()> CancelF;
+
+	bool Generate(UE::Geometry::FDynamicMesh3& OutMesh) const;
+
+private:
+	bool IsCancelled() const;
+
+	// Writes the union of cone heights into the grid, four cells per vector
+	void RasterizeCones(TArray<float>& Heights, const FVector2d& Origin, int32 NumX, int32 NumY, int32 Stride) const;
+
+	// Separable 5-tap binomial blur, horizontal and vertical pass, four cells per vector
+	void Blur(TArray<float>& Heights, int32 NumX, int32 NumY, int32 Stride) const;
+
+	TArray<FIslandShape> Islands;
+};
@@ -0,0 +1,350 @@
+// The source code, authored by Zoxemik in 2025
+
+#include "IslandImplicitMesher.h"
+#include "Async/ParallelFor.h"
+
+using namespace UE::Geometry;
+
+namespace IslandImplicit
+{
+	// Fewest sample layers across the kept Z band, whatever the horizontal cell size
+	static constexpr int32 MinBandLayers = 8;
+
+	// Sample layers kept below and above the band, so the surface never touches the border
+	static constexpr int32 MarginLayers = 2;
+
+	// Exact distance to a capped cone in its (radial, axial) half-plane, axial measured from the cone's mid height
+	static double CappedConeDistance(double Radial, double Axial, double HalfHeight, double BottomRadius, double TopRadius)
+	{
+		const FVector2d Q(Radial, Axial);
+		const FVector2d K1(TopRadius, HalfHeight);
+		const FVector2d K2(TopRadius - BottomRadius, 2.0 * HalfHeight);
+		const FVector2d CA(Q.X - FMath::Min(Q.X, Axial < 0.0 ? BottomRadius : TopRadius), FMath::Abs(Axial) - HalfHeight);
+		const FVector2d CB = Q - K1 + K2 * FMath::Clamp(FVector2d::DotProduct(K1 - Q, K2) / FVector2d::DotProduct(K2, K2), 0.0, 1.0);
+		const double Sign = (CB.X < 0.0 && CA.Y < 0.0) ? -1.0 : 1.0;
+		return Sign * FMath::Sqrt(FMath::Min(FVector2d::DotProduct(CA, CA), FVector2d::DotProduct(CB, CB)));
+	}
+
+	static double BoxDistance(const FVector3d& Position, const FVector3d& Center, const FVector3d& HalfExtents)
+	{
+		const FVector3d D(FMath::Abs(Position.X - Center.X) - HalfExtents.X, FMath::Abs(Position.Y - Center.Y) - HalfExtents.Y, FMath::Abs(Position.Z - Center.Z) - HalfExtents.Z);
+		const FVector3d Outside(FMath::Max(D.X, 0.0), FMath::Max(D.Y, 0.0), FMath::Max(D.Z, 0.0));
+		return Outside.Length() + FMath::Min(FMath::Max(D.X, FMath::Max(D.Y, D.Z)), 0.0);
+	}
+
+	// Polynomial smooth minimum, blends within BlendRadius and is exact outside of it
+	static double SmoothMin(double A, double B, double BlendRadius)
+	{
+		if (BlendRadius <= 0.0)
+		{
+			return FMath::Min(A, B);
+		}
+		const double H = FMath::Max(BlendRadius - FMath::Abs(A - B), 0.0) / BlendRadius;
+		return FMath::Min(A, B) - H * H * BlendRadius * 0.25;
+	}
+}
+
+FIslandImplicitMesher::FIslandImplicitMesher(const TArray<FIslandShape>& InIslands)
+{
+	Cones.Reserve(InIslands.Num());
+	for (const FIslandShape& Island : InIslands)
+	{
+		// Same cone CreateIsland always appended: base 800 units under the water plane, top radius a quarter of the base
+		FCone& Cone = Cones.AddDefaulted_GetRef();
+		Cone.Center = FVector2d(Island.Center.X, Island.Center.Y);
+		Cone.BaseZ = -800.0;
+		Cone.HalfHeight = Island.Height * 0.5;
+		Cone.BottomRadius = Island.Radius;
+		Cone.TopRadius = Island.Radius / 4.0;
+	}
+}
+
+bool FIslandImplicitMesher::IsCancelled() const
+{
+	return CancelF && CancelF();
+}
+
+double FIslandImplicitMesher::EvaluateUnclipped(const FVector3d& Position, const TArray<int32>* Candidates) const
+{
+	// Base slab under all islands, SlabHalfExtent wide as MeshImplicit sizes it. It ends below the bottom cut, so only its
+	// blend into the cone flanks reaches the kept band
+	double Distance = IslandImplicit::BoxDistance(Position, FVector3d(0.0, 0.0, -600.0), FVector3d(SlabHalfExtent, SlabHalfExtent, 200.0));
+
+	auto AddCone = [&](const FCone& Cone)
+	{
+		const double Radial = FVector2d::Distance(FVector2d(Position.X, Position.Y), Cone.Center);
+		const double Axial = Position.Z - (Cone.BaseZ + Cone.HalfHeight);
+		Distance = IslandImplicit::SmoothMin(Distance, IslandImplicit::CappedConeDistance(Radial, Axial, Cone.HalfHeight, Cone.BottomRadius, Cone.TopRadius), BlendRadius);
+	};
+
+	if (Candidates)
+	{
+		for (int32 ConeIndex : *Candidates)
+		{
+			AddCone(Cones[ConeIndex]);
+		}
+	}
+	else
+	{
+		for (const FCone& Cone : Cones)
+		{
+			AddCone(Cone);
+		}
+	}
+
+	return Distance;
+}
+
+double FIslandImplicitMesher::Evaluate(const FVector3d& Position) const
+{
+	// Intersect with the band between the bottom and top cut planes
+	const double Clip = FMath::Max(MinZ - Position.Z, Position.Z - MaxZ);
+	return FMath::Max(EvaluateUnclipped(Position, nullptr), Clip);
+}
+
+bool FIslandImplicitMesher::Generate(FDynamicMesh3& OutMesh) const
+{
+	OutMesh.Clear();
+	if (Cones.Num() == 0 || CellSize <= 0.0)
+	{
+		return !IsCancelled();
+	}
+
+	// Grid bounds: union of the cone footprints plus the blend radius, two cells of margin so the surface never touches the border
+	const double Margin = 2.0 * CellSize;
+	FAxisAlignedBox2d Footprint = FAxisAlignedBox2d::Empty();
+	for (const FCone& Cone : Cones)
+	{
+		const double Reach = Cone.BottomRadius + BlendRadius + Margin;
+		Footprint.Contain(Cone.Center - FVector2d(Reach, Reach));
+		Footprint.Contain(Cone.Center + FVector2d(Reach, Reach));
+	}
+
+	// The band is far thinner than the footprint, so Z gets its own spacing. Layers sit half a step off the cut planes,
+	// a layer exactly on one would read the clip as 0 and never count as inside
+	const int32 BandLayers = FMath::Max(IslandImplicit::MinBandLayers, FMath::CeilToInt32((MaxZ - MinZ) / CellSize));
+	const double CellSizeZ = (MaxZ - MinZ) / BandLayers;
+	const FVector3d Spacing(CellSize, CellSize, CellSizeZ);
+
+	const FVector3d Origin(Footprint.Min.X, Footprint.Min.Y, MinZ - (IslandImplicit::MarginLayers + 0.5) * CellSizeZ);
+	const int32 NumX = FMath::CeilToInt32(Footprint.Width() / CellSize) + 1;
+	const int32 NumY = FMath::CeilToInt32(Footprint.Height() / CellSize) + 1;
+	const int32 NumZ = BandLayers + 2 * IslandImplicit::MarginLayers + 2;
+	if (NumX < 2 || NumY < 2 || MaxZ <= MinZ)
+	{
+		return !IsCancelled();
+	}
+
+	// Samples are stored column-major (Z fastest) so every column is evaluated and read contiguously
+	auto SampleIndex = [NumX, NumZ](int32 X, int32 Y, int32 Z) { return Z + NumZ * (X + NumX * Y); };
+	auto SamplePosition = [&Origin, &Spacing](int32 X, int32 Y, int32 Z) { return Origin + FVector3d(X, Y, Z) * Spacing; };
+
+	TArray<float> Values;
+	Values.SetNumUninitialized(NumX * NumY * NumZ);
+
+	// Pass 1: evaluate the field, one row of columns per task, only against cones that can reach the column
+	ParallelFor(NumY, [&](int32 Y)
+	{
+		TArray<int32> Candidates;
+		for (int32 X = 0; X < NumX; ++X)
+		{
+			const FVector2d Column(Origin.X + X * CellSize, Origin.Y + Y * CellSize);
+
+			Candidates.Reset();
+			for (int32 ConeIndex = 0; ConeIndex < Cones.Num(); ++ConeIndex)
+			{
+				const FCone& Cone = Cones[ConeIndex];
+				const double Reach = Cone.BottomRadius + BlendRadius + Margin;
+				if (FVector2d::DistSquared(Column, Cone.Center) <= Reach * Reach)
+				{
+					Candidates.Add(ConeIndex);
+				}
+			}
+
+			for (int32 Z = 0; Z < NumZ; ++Z)
+			{
+				const FVector3d Position = SamplePosition(X, Y, Z);
+				const double Clip = FMath::Max(MinZ - Position.Z, Position.Z - MaxZ);
+				Values[SampleIndex(X, Y, Z)] = (float)FMath::Max(EvaluateUnclipped(Position, &Candidates), Clip);
+			}
+		}
+	});
+
+	if (IsCancelled()) { return false; }
+
+	// Pass 2: one vertex per cell with a sign change, placed at the average of its edge crossings
+	const int32 CellsX = NumX - 1;
+	const int32 CellsY = NumY - 1;
+	const int32 CellsZ = NumZ - 1;
+	auto CellIndex = [CellsX, CellsZ](int32 X, int32 Y, int32 Z) { return Z + CellsZ * (X + CellsX * Y); };
+
+	TArray<int32> CellVertex;
+	CellVertex.Init(INDEX_NONE, CellsX * CellsY * CellsZ);
+
+	TArray<TArray<FVector3d>> RowVertices;
+	RowVertices.SetNum(CellsY);
+
+	ParallelFor(CellsY, [&](int32 Y)
+	{
+		TArray<FVector3d>& Vertices = RowVertices[Y];
+		for (int32 X = 0; X < CellsX; ++X)
+		{
+			for (int32 Z = 0; Z < CellsZ; ++Z)
+			{
+				float Corner[8];
+				int32 InsideMask = 0;
+				for (int32 i = 0; i < 8; ++i)
+				{
+					Corner[i] = Values[SampleIndex(X + (i & 1), Y + ((i >> 1) & 1), Z + ((i >> 2) & 1))];
+					InsideMask |= (Corner[i] < 0.0f) ? (1 << i) : 0;
+				}
+
+				if (InsideMask == 0 || InsideMask == 0xFF)
+				{
+					continue;
+				}
+
+				FVector3d Sum = FVector3d::ZeroVector;
+				int32 NumCrossings = 0;
+				for (int32 i = 0; i < 8; ++i)
+				{
+					for (int32 Bit = 1; Bit <= 4; Bit <<= 1)
+					{
+						const int32 j = i | Bit;
+						if ((i & Bit) || ((InsideMask >> i) & 1) == ((InsideMask >> j) & 1))
+						{
+							continue;
+						}
+
+						const double T = Corner[i] / (double)(Corner[i] - Corner[j]);
+						const FVector3d A(i & 1, (i >> 1) & 1, (i >> 2) & 1);
+						const FVector3d B(j & 1, (j >> 1) & 1, (j >> 2) & 1);
+						Sum += Lerp(A, B, T);
+						++NumCrossings;
+					}
+				}
+
+				CellVertex[CellIndex(X, Y, Z)] = Vertices.Add(SamplePosition(X, Y, Z) + (Sum / NumCrossings) * Spacing);
+			}
+		}
+	});
+
+	if (IsCancelled()) { return false; }
+
+	// Turn the row local vertex indices into mesh vertex IDs
+	TArray<int32> RowBase;
+	RowBase.SetNum(CellsY);
+	for (int32 Y = 0; Y < CellsY; ++Y)
+	{
+		RowBase[Y] = OutMesh.VertexCount();
+		for (const FVector3d& Vertex : RowVertices[Y])
+		{
+			OutMesh.AppendVertex(Vertex);
+		}
+	}
+
+	ParallelFor(CellsY, [&](int32 Y)
+	{
+		for (int32 X = 0; X < CellsX; ++X)
+		{
+			for (int32 Z = 0; Z < CellsZ; ++Z)
+			{
+				int32& Vertex = CellVertex[CellIndex(X, Y, Z)];
+				if (Vertex != INDEX_NONE)
+				{
+					Vertex += RowBase[Y];
+				}
+			}
+		}
+	});
+
+	// Pass 3: every grid edge with a sign change becomes a quad joining the four cells around it
+	const int32 NumSamples[3] = { NumX, NumY, NumZ };
+	const int32 NumCells[3] = { CellsX, CellsY, CellsZ };
+
+	TArray<TArray<FIndex3i>> RowTriangles;
+	RowTriangles.SetNum(NumY);
+
+	ParallelFor(NumY, [&](int32 Y)
+	{
+		TArray<FIndex3i>& Triangles = RowTriangles[Y];
+		for (int32 X = 0; X < NumX; ++X)
+		{
+			for (int32 Z = 0; Z < NumZ; ++Z)
+			{
+				const int32 P[3] = { X, Y, Z };
+				const bool bInside = Values[SampleIndex(X, Y, Z)] < 0.0f;
+
+				for (int32 Axis = 0; Axis < 3; ++Axis)
+				{
+					// The two other axes, in cyclic order so all three edge directions wind the same way
+					const int32 AxisB = (Axis + 1) % 3;
+					const int32 AxisC = (Axis + 2) % 3;
+					if (P[Axis] >= NumCells[Axis] || P[AxisB] < 1 || P[AxisB] >= NumCells[AxisB] || P[AxisC] < 1 || P[AxisC] >= NumCells[AxisC])
+					{
+						continue;
+					}
+
+					int32 Next[3] = { X, Y, Z };
+					Next[Axis] += 1;
+					if (bInside == (Values[SampleIndex(Next[0], Next[1], Next[2])] < 0.0f))
+					{
+						continue;
+					}
+
+					const int32 OffsetB[4] = { -1, 0, 0, -1 };
+					const int32 OffsetC[4] = { -1, -1, 0, 0 };
+					int32 Quad[4];
+					for (int32 k = 0; k < 4; ++k)
+					{
+						int32 Cell[3] = { X, Y, Z };
+						Cell[AxisB] += OffsetB[k];
+						Cell[AxisC] += OffsetC[k];
+						Quad[k] = CellVertex[CellIndex(Cell[0], Cell[1], Cell[2])];
+					}
+
+					// The quad runs counter-clockwise around the edge seen from its positive end, which faces the negative end in
+					// the engine's left-handed winding. Outside is where the sign change leads, so an edge leaving the solid
+					// takes the reverse order
+					if (bInside)
+					{
+						Triangles.Add(FIndex3i(Quad[0], Quad[2], Quad[1]));
+						Triangles.Add(FIndex3i(Quad[0], Quad[3], Quad[2]));
+					}
+					else
+					{
+						Triangles.Add(FIndex3i(Quad[0], Quad[1], Quad[2]));
+						Triangles.Add(FIndex3i(Quad[0], Quad[2], Quad[3]));
+					}
+				}
+			}
+		}
+	});
+
+	if (IsCancelled()) { return false; }
+
+	for (const TArray<FIndex3i>& Triangles : RowTriangles)
+	{
+		for (const FIndex3i& Triangle : Triangles)
+		{
+			// Ambiguous cell configurations can produce a non-manifold edge, those triangles are skipped
+			OutMesh.AppendTriangle(Triangle);
+		}
+	}
+
+	// Border cells can own a vertex without any quad, drop them so later stages only see the surface
+	TArray<int32> Unreferenced;
+	for (int32 VertexID : OutMesh.VertexIndicesItr())
+	{
+		if (!OutMesh.IsReferencedVertex(VertexID))
+		{
+			Unreferenced.Add(VertexID);
+		}
+	}
+	for (int32 VertexID : Unreferenced)
+	{
+		OutMesh.RemoveVertex(VertexID);
+	}
+
+	return !IsCancelled();
+}
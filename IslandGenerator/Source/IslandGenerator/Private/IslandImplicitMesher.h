@@ -0,0 +1,52 @@
+// The source code, authored by Zoxemik in 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "DynamicMesh/DynamicMesh3.h"
+#include "IslandMeshBuilder.h"
+
+// Meshes the archipelago as a smooth union of analytic truncated cones and the base slab,
+// clipped to the band the plane cuts keep, without ever building a triangle soup to voxelize
+class FIslandImplicitMesher
+{
+public:
+	FIslandImplicitMesher(const TArray<FIslandShape>& InIslands);
+
+	// Size of a grid cell in X and Y in world units, Z spacing follows from the MinZ to MaxZ band
+	double CellSize = 400.0;
+
+	// Radius of the polynomial smooth-min used to blend islands into each other and the slab
+	double BlendRadius = 400.0;
+
+	// Z range the surface is clipped to, matches the bottom and top plane cuts
+	double MinZ = -390.0;
+	double MaxZ = 0.0;
+
+	// Half-width of the base slab in X and Y
+	double SlabHalfExtent = 10000.0;
+
+	TFunction<bool()> CancelF;
+
+	// Evaluates the field into a dense grid and extracts the zero level set with a parallel surface-nets kernel
+	bool Generate(UE::Geometry::FDynamicMesh3& OutMesh) const;
+
+	// Signed distance to the clipped union, negative inside
+	double Evaluate(const FVector3d& Position) const;
+
+private:
+	double EvaluateUnclipped(const FVector3d& Position, const TArray<int32>* Candidates) const;
+
+	bool IsCancelled() const;
+
+	struct FCone
+	{
+		FVector2d Center;
+		double BaseZ;
+		double HalfHeight;
+		double BottomRadius;
+		double TopRadius;
+	};
+
+	TArray<FCone> Cones;
+};
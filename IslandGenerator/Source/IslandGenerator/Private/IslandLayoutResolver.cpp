@@ -0,0 +1,212 @@
+// The source code, authored by Zoxemik in 2025
+
+#include "IslandLayoutResolver.h"
+
+namespace IslandLayout
+{
+	// Same cone every mesher builds: base 800 units under the water plane, top radius a quarter of the base
+	static constexpr double BaseZ = -800.0;
+	static constexpr double TopRadiusScale = 0.25;
+
+	// Band kept by the bottom and top plane cuts
+	static constexpr double MinZ = -390.0;
+	static constexpr double MaxZ = 0.0;
+
+	// Resolution of the coverage estimate over the spawn area
+	static constexpr int32 CoverageGridSize = 128;
+
+	// Visible footprints, bucketed by center in cells at least one footprint diameter wide,
+	// so any two overlapping footprints are at most one cell apart
+	class FFootprintGrid
+	{
+	public:
+		FFootprintGrid(double InCellSize)
+			: CellSize(FMath::Max(InCellSize, 1.0))
+		{
+		}
+
+		void Add(const FVector& Center, int32 Index)
+		{
+			Cells.FindOrAdd(GetCell(Center)).Add(Index);
+		}
+
+		template<typename FunctionType>
+		bool AnyNear(const FVector& Center, FunctionType&& Predicate) const
+		{
+			const FIntPoint Cell = GetCell(Center);
+			for (int32 Y = Cell.Y - 1; Y <= Cell.Y + 1; ++Y)
+			{
+				for (int32 X = Cell.X - 1; X <= Cell.X + 1; ++X)
+				{
+					if (const TArray<int32>* Indices = Cells.Find(FIntPoint(X, Y)))
+					{
+						for (int32 Index : *Indices)
+						{
+							if (Predicate(Index))
+							{
+								return true;
+							}
+						}
+					}
+				}
+			}
+			return false;
+		}
+
+	private:
+		FIntPoint GetCell(const FVector& Center) const
+		{
+			return FIntPoint(FMath::FloorToInt32(Center.X / CellSize), FMath::FloorToInt32(Center.Y / CellSize));
+		}
+
+		double CellSize;
+
+		TMap<FIntPoint, TArray<int32>> Cells;
+	};
+}
+
+FIslandLayoutResolver::FIslandLayoutResolver(const FIslandGenerationSettings& InSettings)
+	: OverlapMode(InSettings.OverlapMode)
+	, TargetLandCoverage(InSettings.TargetLandCoverage)
+	, MaxSpawnDistance(InSettings.MaxSpawnDistance)
+{
+}
+
+double FIslandLayoutResolver::GetRadiusAt(const FIslandShape& Island, double Z)
+{
+	if (Island.Height <= 0.0f)
+	{
+		return -1.0;
+	}
+
+	const double Alpha = (Z - IslandLayout::BaseZ) / Island.Height;
+	if (Alpha < 0.0 || Alpha > 1.0)
+	{
+		return -1.0;
+	}
+
+	return Island.Radius * FMath::Lerp(1.0, IslandLayout::TopRadiusScale, Alpha);
+}
+
+double FIslandLayoutResolver::GetShoreRadius(const FIslandShape& Island)
+{
+	return FMath::Max(GetRadiusAt(Island, IslandLayout::MinZ), 0.0);
+}
+
+bool FIslandLayoutResolver::IsContained(const FIslandShape& Inner, const FIslandShape& Outer)
+{
+	// Both radii are linear in Z, so checking the two ends of Inner's visible band covers every slice in between
+	const double InnerTopZ = FMath::Min(IslandLayout::MaxZ, IslandLayout::BaseZ + Inner.Height);
+	const double Distance = FVector2D::Distance(FVector2D(Inner.Center), FVector2D(Outer.Center));
+
+	for (const double Z : { IslandLayout::MinZ, InnerTopZ })
+	{
+		const double OuterRadius = GetRadiusAt(Outer, Z);
+		if (OuterRadius < 0.0 || Distance + GetRadiusAt(Inner, Z) > OuterRadius)
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+void FIslandLayoutResolver::Resolve(TArray<FIslandShape>& InOutIslands) const
+{
+	if (OverlapMode == EIslandOverlapMode::Allow && TargetLandCoverage <= 0.0f)
+	{
+		return;
+	}
+
+	TArray<double> Footprints;
+	Footprints.SetNumUninitialized(InOutIslands.Num());
+	double MaxFootprint = 0.0;
+	for (int32 Index = 0; Index < InOutIslands.Num(); ++Index)
+	{
+		Footprints[Index] = GetShoreRadius(InOutIslands[Index]);
+		MaxFootprint = FMath::Max(MaxFootprint, Footprints[Index]);
+	}
+
+	// Biggest first, so a cone is only ever tested against the ones that could contain it
+	TArray<int32> Order;
+	Order.Reserve(InOutIslands.Num());
+	for (int32 Index = 0; Index < InOutIslands.Num(); ++Index)
+	{
+		// Cones that end under the bottom cut leave nothing visible
+		if (Footprints[Index] > 0.0)
+		{
+			Order.Add(Index);
+		}
+	}
+	Order.StableSort([&InOutIslands](int32 A, int32 B) { return InOutIslands[A].Radius > InOutIslands[B].Radius; });
+
+	IslandLayout::FFootprintGrid Grid(2.0 * MaxFootprint);
+
+	// Coverage is measured against the disc the centers are rolled in
+	const double SpawnRadius = FMath::Max(MaxSpawnDistance / 2.0, 1.0);
+	const double CoverageExtent = SpawnRadius + MaxFootprint;
+	const double CoverageCellSize = 2.0 * CoverageExtent / IslandLayout::CoverageGridSize;
+	const double TargetCells = TargetLandCoverage * UE_DOUBLE_PI * FMath::Square(SpawnRadius / CoverageCellSize);
+	TBitArray<> Covered(false, TargetLandCoverage > 0.0f ? FMath::Square(IslandLayout::CoverageGridSize) : 0);
+	int32 CoveredCells = 0;
+
+	TBitArray<> Keep(false, InOutIslands.Num());
+	for (int32 Index : Order)
+	{
+		if (TargetLandCoverage > 0.0f && CoveredCells >= TargetCells)
+		{
+			break;
+		}
+
+		const FIslandShape& Island = InOutIslands[Index];
+
+		const bool bRejected = OverlapMode != EIslandOverlapMode::Allow && Grid.AnyNear(Island.Center, [&](int32 Other)
+		{
+			if (OverlapMode == EIslandOverlapMode::Separate)
+			{
+				return FVector2D::Distance(FVector2D(Island.Center), FVector2D(InOutIslands[Other].Center)) < Footprints[Index] + Footprints[Other];
+			}
+			return IsContained(Island, InOutIslands[Other]);
+		});
+		if (bRejected)
+		{
+			continue;
+		}
+
+		Keep[Index] = true;
+		Grid.Add(Island.Center, Index);
+
+		// Rasterize the footprint, only newly covered cells count towards the target
+		if (TargetLandCoverage > 0.0f)
+		{
+			const FVector2D Center(Island.Center);
+			const int32 MinX = FMath::Max(FMath::FloorToInt32((Center.X - Footprints[Index] + CoverageExtent) / CoverageCellSize), 0);
+			const int32 MaxX = FMath::Min(FMath::FloorToInt32((Center.X + Footprints[Index] + CoverageExtent) / CoverageCellSize), IslandLayout::CoverageGridSize - 1);
+			const int32 MinY = FMath::Max(FMath::FloorToInt32((Center.Y - Footprints[Index] + CoverageExtent) / CoverageCellSize), 0);
+			const int32 MaxY = FMath::Min(FMath::FloorToInt32((Center.Y + Footprints[Index] + CoverageExtent) / CoverageCellSize), IslandLayout::CoverageGridSize - 1);
+			for (int32 Y = MinY; Y <= MaxY; ++Y)
+			{
+				for (int32 X = MinX; X <= MaxX; ++X)
+				{
+					const FVector2D CellCenter((X + 0.5) * CoverageCellSize - CoverageExtent, (Y + 0.5) * CoverageCellSize - CoverageExtent);
+					const int32 CellIndex = X + Y * IslandLayout::CoverageGridSize;
+					if (!Covered[CellIndex] && FVector2D::DistSquared(CellCenter, Center) <= FMath::Square(Footprints[Index]))
+					{
+						Covered[CellIndex] = true;
+						++CoveredCells;
+					}
+				}
+			}
+		}
+	}
+
+	// Back to roll order
+	int32 WriteIndex = 0;
+	for (int32 Index = 0; Index < InOutIslands.Num(); ++Index)
+	{
+		if (Keep[Index])
+		{
+			InOutIslands[WriteIndex++] = InOutIslands[Index];
+		}
+	}
+	InOutIslands.SetNum(WriteIndex);
+}
@@ -0,0 +1,34 @@
+// The source code, authored by Zoxemik in 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "IslandMeshBuilder.h"
+
+// Resolves the rolled cones in 2D before any meshing: drops cones that never reach the kept band or add no land,
+// optionally keeps islands apart and stops once enough of the spawn area is land, so meshers only see visible cones.
+// With EIslandOverlapMode::Allow and no coverage target the layout is left exactly as rolled
+class FIslandLayoutResolver
+{
+public:
+	FIslandLayoutResolver(const FIslandGenerationSettings& InSettings);
+
+	// Filters the islands in place, the survivors keep their roll order
+	void Resolve(TArray<FIslandShape>& InOutIslands) const;
+
+	// Radius of the cone at height Z, negative where the cone does not reach
+	static double GetRadiusAt(const FIslandShape& Island, double Z);
+
+	// Radius of the widest visible slice, where the cone meets the bottom cut, 0 when it never gets there
+	static double GetShoreRadius(const FIslandShape& Island);
+
+private:
+	// Every slice of Inner between the plane cuts lies inside Outer
+	static bool IsContained(const FIslandShape& Inner, const FIslandShape& Outer);
+
+	EIslandOverlapMode OverlapMode;
+
+	float TargetLandCoverage;
+
+	float MaxSpawnDistance;
+};
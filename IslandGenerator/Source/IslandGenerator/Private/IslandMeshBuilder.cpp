@@ -0,0 +1,630 @@
+// The source code, authored by Zoxemik in 2025
+
+#include "IslandMeshBuilder.h"
+#include "IslandImplicitMesher.h"
+#include "IslandHeightfieldMesher.h"
+#include "IslandLayoutResolver.h"
+#include "IslandAdaptiveTessellator.h"
+#include "IslandMeshPostProcessor.h"
+#include "IslandMeshCache.h"
+#include "IslandStageCache.h"
+#include "IslandSurfaceSampler.h"
+#include "IslandTerrainGrid.h"
+#include "DynamicMeshEditor.h"
+#include "DynamicMesh/DynamicMeshAttributeSet.h"
+#include "DynamicMesh/DynamicMeshAABBTree3.h"
+#include "Generators/SweepGenerator.h"
+#include "Implicit/Solidify.h"
+#include "Spatial/FastWinding.h"
+#include "Operations/PNTriangles.h"
+#include "Operations/MeshPlaneCut.h"
+#include "Parameterization/DynamicMeshUVEditor.h"
+#include "ConstrainedDelaunay2.h"
+#include "MeshTransforms.h"
+#include "Async/ParallelFor.h"
+
+using namespace UE::Geometry;
+
+DECLARE_CYCLE_STAT(TEXT("Append Primitives"), STAT_Island_Append, STATGROUP_IslandGenerator);
+DECLARE_CYCLE_STAT(TEXT("Solidify"), STAT_Island_Solidify, STATGROUP_IslandGenerator);
+DECLARE_CYCLE_STAT(TEXT("Implicit Mesh"), STAT_Island_ImplicitMesh, STATGROUP_IslandGenerator);
+DECLARE_CYCLE_STAT(TEXT("Heightfield Mesh"), STAT_Island_HeightfieldMesh, STATGROUP_IslandGenerator);
+DECLARE_CYCLE_STAT(TEXT("Post Process"), STAT_Island_PostProcess, STATGROUP_IslandGenerator);
+DECLARE_CYCLE_STAT(TEXT("Tessellation"), STAT_Island_Tessellation, STATGROUP_IslandGenerator);
+DECLARE_CYCLE_STAT(TEXT("Bottom Cut"), STAT_Island_BottomCut, STATGROUP_IslandGenerator);
+DECLARE_CYCLE_STAT(TEXT("Top Cut"), STAT_Island_TopCut, STATGROUP_IslandGenerator);
+DECLARE_CYCLE_STAT(TEXT("UVs"), STAT_Island_UVs, STATGROUP_IslandGenerator);
+DECLARE_CYCLE_STAT(TEXT("Cache Load"), STAT_Island_CacheLoad, STATGROUP_IslandGenerator);
+DECLARE_CYCLE_STAT(TEXT("Cache Save"), STAT_Island_CacheSave, STATGROUP_IslandGenerator);
+DECLARE_CYCLE_STAT(TEXT("Stage Cache Load"), STAT_Island_StageCacheLoad, STATGROUP_IslandGenerator);
+DECLARE_CYCLE_STAT(TEXT("Tiling"), STAT_Island_Tiling, STATGROUP_IslandGenerator);
+DECLARE_CYCLE_STAT(TEXT("Surface Sampler"), STAT_Island_SurfaceSampler, STATGROUP_IslandGenerator);
+DECLARE_CYCLE_STAT(TEXT("Terrain Grid"), STAT_Island_TerrainGrid, STATGROUP_IslandGenerator);
+
+// Insights event, stat counter and a stats entry for one stage, all under the same name
+#define ISLAND_STAGE_SCOPE(Name, Mesh) \
+	TRACE_CPUPROFILER_EVENT_SCOPE(IslandGenerator_##Name); \
+	SCOPE_CYCLE_COUNTER(STAT_Island_##Name); \
+	FIslandStageScope IslandStageScope(ActiveStats, TEXT(#Name), Mesh)
+
+FIslandStageScope::FIslandStageScope(FIslandGenerationStats* InStats, FName InStageName, const FDynamicMesh3& InMesh)
+	: Stats(InStats)
+	, StageName(InStageName)
+	, Mesh(InMesh)
+	, StartTime(FPlatformTime::Seconds())
+{
+}
+
+FIslandStageScope::~FIslandStageScope()
+{
+	if (Stats)
+	{
+		Record(*Stats, StageName, FPlatformTime::Seconds() - StartTime, Mesh.VertexCount(), Mesh.TriangleCount());
+	}
+}
+
+void FIslandStageScope::Record(FIslandGenerationStats& Stats, FName StageName, double TimeSeconds, int32 VertexCount, int32 TriangleCount)
+{
+	FIslandStageStats& Stage = Stats.Stages.AddDefaulted_GetRef();
+	Stage.StageName = StageName;
+	Stage.TimeMs = (float)(TimeSeconds * 1000.0);
+	Stage.VertexCount = VertexCount;
+	Stage.TriangleCount = TriangleCount;
+
+	const float UsedMemoryMB = (float)(FPlatformMemory::GetStats().UsedPhysical / (1024.0 * 1024.0));
+	Stats.PeakMemoryMB = FMath::Max(Stats.PeakMemoryMB, UsedMemoryMB);
+}
+
+FIslandMeshBuilder::FIslandMeshBuilder(const FIslandGenerationSettings& InSettings, const TArray<FIslandShape>& InIslands)
+	: Settings(InSettings)
+	, Islands(InIslands)
+{
+}
+
+void FIslandMeshBuilder::BuildLayout(const FIslandGenerationSettings& Settings, TArray<FIslandShape>& OutIslands)
+{
+	OutIslands.Reset(Settings.MaxNumberOfIslands);
+
+	// Work on a copy so the same settings always roll the same layout
+	FRandomStream Stream = Settings.Seed;
+
+	for (int32 i = 0; i < Settings.MaxNumberOfIslands; ++i)
+	{
+		// Generate a random island radius within the specified range
+		FIslandShape& Island = OutIslands.AddDefaulted_GetRef();
+		Island.Radius = Stream.FRandRange(Settings.IslandSize.X, Settings.IslandSize.Y);
+		Island.Height = Settings.IslandHeight;
+
+		// Generate a random unit vector and scale it by half the maximum spawn distance
+		FVector RandomVector = Stream.VRand() * (Settings.MaxSpawnDistance / 2.0f);
+		Island.Center = FVector(RandomVector.X, RandomVector.Y, 0.0f);
+	}
+
+	// Every island is rolled first, so resolving never shifts the stream and a seed keeps its layout
+	FIslandLayoutResolver(Settings).Resolve(OutIslands);
+}
+
+bool FIslandMeshBuilder::IsCancelled() const
+{
+	return CancelF && CancelF();
+}
+
+bool FIslandMeshBuilder::Build(FDynamicMesh3& OutMesh) const
+{
+	OutMesh.Clear();
+
+	const TArray<FIslandPipelineStage> Stages = MakeStages();
+
+	// Resume after the last stage whose output is memoized, every stage before it has the same inputs as last time
+	int32 FirstStage = 0;
+	if (Settings.bUseStageCache)
+	{
+		ISLAND_STAGE_SCOPE(StageCacheLoad, OutMesh);
+		for (int32 StageIndex = Stages.Num() - 1; StageIndex >= 0; --StageIndex)
+		{
+			if (FIslandStageCache::Find(Stages[StageIndex].Key, OutMesh))
+			{
+				FirstStage = StageIndex + 1;
+				break;
+			}
+		}
+	}
+
+	for (int32 StageIndex = FirstStage; StageIndex < Stages.Num(); ++StageIndex)
+	{
+		// A cancelled stage may have left the mesh half done, it must never reach the cache
+		if (!Stages[StageIndex].Run(OutMesh) || IsCancelled())
+		{
+			return false;
+		}
+
+		if (Settings.bUseStageCache)
+		{
+			FIslandStageCache::Store(Stages[StageIndex].Key, OutMesh, Settings.MaxStageCacheSizeMB);
+		}
+	}
+
+	return !IsCancelled();
+}
+
+uint64 FIslandMeshBuilder::MakeLayoutKey() const
+{
+	FIslandStageKey Key(Islands.Num());
+	for (const FIslandShape& Island : Islands)
+	{
+		Key.Add(Island.Center.X).Add(Island.Center.Y).Add(Island.Radius).Add(Island.Height);
+	}
+	return Key.Finalize();
+}
+
+TArray<FIslandPipelineStage> FIslandMeshBuilder::MakeStages() const
+{
+	TArray<FIslandPipelineStage> Stages;
+
+	// Every stage chains onto the key of the one before it, so changing a parameter only invalidates its own stage and the ones after
+	uint64 InputKey = MakeLayoutKey();
+	auto AddStage = [&Stages, &InputKey](FName Name, FIslandStageKey Key, TFunction<bool(FDynamicMesh3&)>&& Run)
+	{
+		FIslandPipelineStage& Stage = Stages.AddDefaulted_GetRef();
+		Stage.Name = Name;
+		Stage.Key = Key.Add(GetTypeHash(Name)).Finalize();
+		Stage.Run = MoveTemp(Run);
+		InputKey = Stage.Key;
+	};
+
+	const bool bImplicit = Settings.MeshingMethod == EIslandMeshingMethod::ImplicitSDF;
+	const bool bPostProcess = !bImplicit || Settings.bPostProcessImplicitMesh;
+
+	if (Settings.MeshingMethod == EIslandMeshingMethod::Heightfield)
+	{
+		// The heightfield is blurred, clamped to the cut planes and already at the tessellated density
+		AddStage(TEXT("HeightfieldMesh"), FIslandStageKey(InputKey).Add(Settings.MaxSpawnDistance).Add(Settings.IslandGridResolution).Add(Settings.IslandTessellationLevel),
+			[this](FDynamicMesh3& Mesh)
+			{
+				ISLAND_STAGE_SCOPE(HeightfieldMesh, Mesh);
+				return MeshHeightfield(Mesh);
+			});
+
+		if (!Settings.bCollisionOnly)
+		{
+			AddStage(TEXT("PostProcess"), FIslandStageKey(InputKey).Add(Settings.bCollisionOnly),
+				[this](FDynamicMesh3& Mesh)
+				{
+					ISLAND_STAGE_SCOPE(PostProcess, Mesh);
+					return PostProcess(Mesh, 0, true);
+				});
+
+			AddStage(TEXT("UVs"), FIslandStageKey(InputKey).Add(Settings.UVScale),
+				[this](FDynamicMesh3& Mesh)
+				{
+					ISLAND_STAGE_SCOPE(UVs, Mesh);
+					ProjectUVs(Mesh);
+					return true;
+				});
+		}
+
+		return Stages;
+	}
+
+	if (bImplicit)
+	{
+		AddStage(TEXT("ImplicitMesh"), FIslandStageKey(InputKey).Add(Settings.MaxSpawnDistance).Add(Settings.IslandGridResolution).Add(Settings.ImplicitBlendRadius),
+			[this](FDynamicMesh3& Mesh)
+			{
+				ISLAND_STAGE_SCOPE(ImplicitMesh, Mesh);
+				return MeshImplicit(Mesh);
+			});
+	}
+	else
+	{
+		AddStage(TEXT("Append"), FIslandStageKey(InputKey),
+			[this](FDynamicMesh3& Mesh)
+			{
+				ISLAND_STAGE_SCOPE(Append, Mesh);
+				AppendPrimitives(Mesh);
+				return true;
+			});
+
+		AddStage(TEXT("Solidify"), FIslandStageKey(InputKey).Add(Settings.MaxSpawnDistance).Add(Settings.IslandGridResolution),
+			[this](FDynamicMesh3& Mesh)
+			{
+				ISLAND_STAGE_SCOPE(Solidify, Mesh);
+				Solidify(Mesh);
+				return true;
+			});
+	}
+
+	// Normals, then a mild smoothing pass to soften edges, in one packed stage. The tessellation shapes the surface from
+	// the normals, so the collision only profile still computes them when it follows
+	const int32 SmoothingIterations = bPostProcess ? Settings.SmoothingIterations : 0;
+	const bool bComputeNormals = !Settings.bCollisionOnly || Settings.IslandTessellationLevel > 0;
+	AddStage(TEXT("PostProcess"), FIslandStageKey(InputKey).Add(bComputeNormals).Add(SmoothingIterations).Add(Settings.SmoothingAlpha),
+		[this, SmoothingIterations, bComputeNormals](FDynamicMesh3& Mesh)
+		{
+			ISLAND_STAGE_SCOPE(PostProcess, Mesh);
+			return PostProcess(Mesh, SmoothingIterations, bComputeNormals);
+		});
+
+	// Geometry, so it runs in the collision only profile too and the server collides with what clients render
+	AddStage(TEXT("Tessellation"), FIslandStageKey(InputKey).Add(Settings.IslandTessellationLevel).Add(Settings.TessellationMode).Add(Settings.TessellationTriangleBudget)
+		.Add(Settings.TessellationMaxError).Add(Settings.MaxSpawnDistance).Add(Settings.IslandGridResolution),
+		[this](FDynamicMesh3& Mesh)
+		{
+			ISLAND_STAGE_SCOPE(Tessellation, Mesh);
+			return Tessellate(Mesh);
+		});
+
+	// Cut the underside of the mesh to flatten it, then cut/flatten the top
+	if (bPostProcess)
+	{
+		AddStage(TEXT("BottomCut"), FIslandStageKey(InputKey),
+			[this](FDynamicMesh3& Mesh)
+			{
+				ISLAND_STAGE_SCOPE(BottomCut, Mesh);
+				PlaneCut(Mesh, FVector3d(0.0, 0.0, -390.0), FVector3d(0.0, 0.0, -1.0), false);
+				return true;
+			});
+
+		AddStage(TEXT("TopCut"), FIslandStageKey(InputKey),
+			[this](FDynamicMesh3& Mesh)
+			{
+				ISLAND_STAGE_SCOPE(TopCut, Mesh);
+				PlaneCut(Mesh, FVector3d(0.0, 0.0, 0.0), FVector3d(0.0, 0.0, 1.0), true);
+				return true;
+			});
+	}
+
+	if (!Settings.bCollisionOnly)
+	{
+		AddStage(TEXT("UVs"), FIslandStageKey(InputKey).Add(Settings.UVScale),
+			[this](FDynamicMesh3& Mesh)
+			{
+				ISLAND_STAGE_SCOPE(UVs, Mesh);
+				ProjectUVs(Mesh);
+				return true;
+			});
+	}
+
+	return Stages;
+}
+
+bool FIslandMeshBuilder::Build(FIslandBuildResult& OutResult) const
+{
+	const double StartTime = FPlatformTime::Seconds();
+
+	OutResult.Tiles.Reset();
+	OutResult.Surface.Reset();
+	OutResult.Terrain.Reset();
+	OutResult.bFromCache = false;
+	OutResult.Stats = FIslandGenerationStats();
+
+	// Every stage from here on records into the result
+	ActiveStats = &OutResult.Stats;
+	const bool bBuilt = BuildInternal(OutResult);
+	ActiveStats = nullptr;
+
+	if (!bBuilt)
+	{
+		return false;
+	}
+
+	OutResult.Stats.bFromCache = OutResult.bFromCache;
+	OutResult.Stats.TotalTimeMs = (float)((FPlatformTime::Seconds() - StartTime) * 1000.0);
+
+	return !IsCancelled();
+}
+
+bool FIslandMeshBuilder::BuildLOD(int32 LODIndex, FDynamicMesh3& OutMesh) const
+{
+	FIslandMeshBuilder LODBuilder(MakeLODSettings(Settings, LODIndex), Islands);
+	LODBuilder.CancelF = CancelF;
+	return LODBuilder.Build(OutMesh);
+}
+
+FIslandGenerationSettings FIslandMeshBuilder::MakeLODSettings(const FIslandGenerationSettings& Settings, int32 LODIndex)
+{
+	FIslandGenerationSettings LODSettings = Settings;
+	LODSettings.IslandGridResolution = FMath::Max(FMath::RoundToInt32(Settings.IslandGridResolution * FMath::Pow(Settings.LODResolutionScale, (float)LODIndex)), 2);
+	LODSettings.IslandTessellationLevel = 0;
+	LODSettings.TileGridSize = FIntPoint(0, 0);
+	LODSettings.bUseMeshCache = false;
+	LODSettings.NumLODs = 1;
+	LODSettings.TerrainGridResolution = 0;
+	return LODSettings;
+}
+
+int64 FIslandMeshBuilder::EstimatePeakMemory(const FIslandGenerationSettings& Settings)
+{
+	const int64 GridCells = FMath::Max(Settings.IslandGridResolution, 2) + 4;
+	const int64 EdgeSegments = FMath::Max(Settings.IslandTessellationLevel, 0) + 1;
+
+	// The voxel and implicit paths hold a full 3D grid, the heightfield only a 2D one at the tessellated spacing
+	const int64 GridBytes = Settings.MeshingMethod == EIslandMeshingMethod::Heightfield
+		? FMath::Square(GridCells * EdgeSegments) * 16
+		: GridCells * GridCells * GridCells * 12;
+
+	// Surface of the grid after tessellation at about 200 bytes a triangle with attributes, and one copy of it in flight
+	const int64 MeshBytes = GridCells * GridCells * 4 * EdgeSegments * EdgeSegments * 200;
+
+	return GridBytes + MeshBytes * 2;
+}
+
+bool FIslandMeshBuilder::BuildInternal(FIslandBuildResult& OutResult) const
+{
+	TArray<FVector> SpawnPoints;
+	for (const FIslandShape& Island : Islands)
+	{
+		SpawnPoints.Add(Island.Center);
+	}
+
+	// Same seed and parameters always give the same mesh, so any earlier build of it can be reused as is
+	const uint64 CacheKey = Settings.bUseMeshCache ? FIslandMeshCache::MakeKey(Settings) : 0;
+	bool bCacheHit = false;
+	if (Settings.bUseMeshCache)
+	{
+		ISLAND_STAGE_SCOPE(CacheLoad, OutResult.Mesh);
+		TArray<FVector> CachedSpawnPoints;
+		bCacheHit = FIslandMeshCache::Load(CacheKey, OutResult.Mesh, CachedSpawnPoints) && CachedSpawnPoints == SpawnPoints;
+	}
+
+	if (bCacheHit)
+	{
+		OutResult.bFromCache = true;
+	}
+	else
+	{
+		if (!Build(OutResult.Mesh))
+		{
+			return false;
+		}
+
+		if (Settings.bUseMeshCache)
+		{
+			ISLAND_STAGE_SCOPE(CacheSave, OutResult.Mesh);
+			FIslandMeshCache::Save(CacheKey, OutResult.Mesh, SpawnPoints, Settings.MaxMeshCacheSizeMB);
+		}
+	}
+
+	{
+		ISLAND_STAGE_SCOPE(SurfaceSampler, OutResult.Mesh);
+		OutResult.Surface = MakeShared<FIslandSurfaceSampler>(OutResult.Mesh);
+	}
+
+	if (Settings.TerrainGridResolution > 0)
+	{
+		ISLAND_STAGE_SCOPE(TerrainGrid, OutResult.Mesh);
+		OutResult.Terrain = MakeShared<FIslandTerrainGrid>(OutResult.Mesh, Islands, Settings.TerrainGridResolution, Settings.BiomeRules);
+	}
+
+	if (Settings.IsTiled())
+	{
+		ISLAND_STAGE_SCOPE(Tiling, OutResult.Mesh);
+		SplitIntoTiles(OutResult.Mesh, Settings.TileGridSize, GetTileFrame(Settings), OutResult.Tiles);
+		OutResult.Mesh.Clear();
+	}
+
+	return !IsCancelled();
+}
+
+FAxisAlignedBox2d FIslandMeshBuilder::GetTileFrame(const FIslandGenerationSettings& Settings)
+{
+	// Same square the old base box covered, so a layout change never moves the tile borders
+	const double HalfExtent = (Settings.MaxSpawnDistance + 10000.0) / 2.0;
+	return FAxisAlignedBox2d(FVector2d(-HalfExtent, -HalfExtent), FVector2d(HalfExtent, HalfExtent));
+}
+
+void FIslandMeshBuilder::SplitIntoTiles(const FDynamicMesh3& Mesh, FIntPoint GridSize, const FAxisAlignedBox2d& Frame, TArray<FIslandMeshTile>& OutTiles)
+{
+	GridSize.X = FMath::Max(GridSize.X, 1);
+	GridSize.Y = FMath::Max(GridSize.Y, 1);
+
+	OutTiles.Reset();
+	OutTiles.SetNum(GridSize.X * GridSize.Y);
+
+	// Tiles are laid out over the fixed frame, not this mesh's bounds, so a tile only changes when its own triangles do
+	const FVector2d TileSize(FMath::Max(Frame.Width() / GridSize.X, UE_DOUBLE_KINDA_SMALL_NUMBER), FMath::Max(Frame.Height() / GridSize.Y, UE_DOUBLE_KINDA_SMALL_NUMBER));
+
+	// Bucket the triangles by centroid
+	TArray<TArray<int32>> TileTriangles;
+	TileTriangles.SetNum(OutTiles.Num());
+	for (int32 TriangleID : Mesh.TriangleIndicesItr())
+	{
+		const FVector3d Centroid = Mesh.GetTriCentroid(TriangleID);
+		const int32 TileX = FMath::Clamp(FMath::FloorToInt32((Centroid.X - Frame.Min.X) / TileSize.X), 0, GridSize.X - 1);
+		const int32 TileY = FMath::Clamp(FMath::FloorToInt32((Centroid.Y - Frame.Min.Y) / TileSize.Y), 0, GridSize.Y - 1);
+		TileTriangles[TileX + TileY * GridSize.X].Add(TriangleID);
+	}
+
+	// Copy every bucket into its own mesh, with the same attribute layout as the source
+	ParallelFor(OutTiles.Num(), [&](int32 TileIndex)
+	{
+		FIslandMeshTile& Tile = OutTiles[TileIndex];
+		Tile.Mesh.EnableMatchingAttributes(Mesh);
+
+		if (TileTriangles[TileIndex].Num() > 0)
+		{
+			FDynamicMeshEditor Editor(&Tile.Mesh);
+			FMeshIndexMappings Mappings;
+			FDynamicMeshEditResult EditResult;
+			Editor.AppendTriangles(&Mesh, TileTriangles[TileIndex], Mappings, EditResult, false);
+		}
+
+		// Positions and topology are enough to tell whether a tile changed between two builds
+		uint32 Hash = GetTypeHash(Tile.Mesh.TriangleCount());
+		for (int32 VertexID : Tile.Mesh.VertexIndicesItr())
+		{
+			const FVector3d Position = Tile.Mesh.GetVertex(VertexID);
+			Hash = FCrc::MemCrc32(&Position, sizeof(Position), Hash);
+		}
+		for (int32 TriangleID : Tile.Mesh.TriangleIndicesItr())
+		{
+			const FIndex3i Triangle = Tile.Mesh.GetTriangle(TriangleID);
+			Hash = FCrc::MemCrc32(&Triangle, sizeof(Triangle), Hash);
+		}
+		Tile.Hash = Hash;
+	});
+}
+
+void FIslandMeshBuilder::AppendPrimitives(FDynamicMesh3& Mesh) const
+{
+	FDynamicMeshEditor Editor(&Mesh);
+
+	for (const FIslandShape& Island : Islands)
+	{
+		// Cone with its base 800 units under the water plane, same tessellation as Geometry Script's AppendCone
+		FCylinderGenerator ConeGenerator;
+		ConeGenerator.Radius[0] = Island.Radius;
+		ConeGenerator.Radius[1] = Island.Radius / 4.0f;
+		ConeGenerator.Height = Island.Height;
+		ConeGenerator.AngleSamples = 12;
+		ConeGenerator.LengthSamples = 3;
+		ConeGenerator.bCapped = true;
+
+		FDynamicMesh3 ConeMesh(&ConeGenerator.Generate());
+		MeshTransforms::Translate(ConeMesh, FVector3d(Island.Center.X, Island.Center.Y, -800.0));
+
+		FMeshIndexMappings Mappings;
+		Editor.AppendMesh(&ConeMesh, Mappings);
+	}
+
+	// No base box any more: it sat entirely under the bottom cut and only stretched the voxel grid over open water
+}
+
+void FIslandMeshBuilder::Solidify(FDynamicMesh3& Mesh) const
+{
+	// Fills in any cavities or ensures it's a solid volume
+	if (Mesh.TriangleCount() == 0)
+	{
+		return;
+	}
+
+	FDynamicMeshAABBTree3 Spatial(&Mesh);
+	TFastWindingTree<FDynamicMesh3> FastWinding(&Spatial);
+
+	// Same cell size the old base box gave IslandGridResolution, but the grid only spans the cone footprints
+	const double CellSize = (Settings.MaxSpawnDistance + 10000.0) / FMath::Max(Settings.IslandGridResolution, 2);
+	const FAxisAlignedBox3d Bounds = Spatial.GetBoundingBox();
+	const double Margin = 2.0 * CellSize;
+
+	TImplicitSolidify<FDynamicMesh3> Solidify(&Mesh, &Spatial, &FastWinding);
+	Solidify.SetCellSizeAndExtendBounds(Bounds, Margin, FMath::Max(FMath::CeilToInt32((Bounds.MaxDim() + 2.0 * Margin) / CellSize), 2));
+	Solidify.WindingThreshold = 0.5;
+	Solidify.SurfaceSearchSteps = 64;
+	Solidify.bSolidAtBoundaries = false;
+	Solidify.CancelF = [this]() { return IsCancelled(); };
+
+	FDynamicMesh3 SolidMesh(&Solidify.Generate());
+	Mesh = MoveTemp(SolidMesh);
+}
+
+bool FIslandMeshBuilder::MeshImplicit(FDynamicMesh3& Mesh) const
+{
+	// Same cell size Solidify ends up with on the base box, so IslandGridResolution means the same in both paths
+	const double BaseExtent = Settings.MaxSpawnDistance + 10000.0;
+
+	FIslandImplicitMesher Mesher(Islands);
+	Mesher.CellSize = BaseExtent / FMath::Max(Settings.IslandGridResolution, 2);
+	Mesher.BlendRadius = Settings.ImplicitBlendRadius;
+	Mesher.SlabHalfExtent = BaseExtent / 2.0;
+	Mesher.CancelF = [this]() { return IsCancelled(); };
+
+	return Mesher.Generate(Mesh);
+}
+
+bool FIslandMeshBuilder::MeshHeightfield(FDynamicMesh3& Mesh) const
+{
+	// Match the vertex spacing the voxel path reaches after PN tessellation splits every edge
+	const double BaseExtent = Settings.MaxSpawnDistance + 10000.0;
+	const int32 EdgeSegments = FMath::Max(Settings.IslandTessellationLevel, 0) + 1;
+
+	FIslandHeightfieldMesher Mesher(Islands);
+	Mesher.CellSize = BaseExtent / (FMath::Max(Settings.IslandGridResolution, 2) * EdgeSegments);
+	Mesher.CancelF = [this]() { return IsCancelled(); };
+
+	return Mesher.Generate(Mesh);
+}
+
+bool FIslandMeshBuilder::PostProcess(FDynamicMesh3& Mesh, int32 SmoothingIterations, bool bComputeNormals) const
+{
+	// Normals only feed shading and the tessellation, collision never reads them
+	FIslandMeshPostProcessor PostProcessor;
+	PostProcessor.bComputeNormals = bComputeNormals;
+	PostProcessor.SmoothingIterations = SmoothingIterations;
+	PostProcessor.SmoothingAlpha = Settings.SmoothingAlpha;
+	PostProcessor.CancelF = [this]() { return IsCancelled(); };
+
+	return PostProcessor.Apply(Mesh);
+}
+
+bool FIslandMeshBuilder::Tessellate(FDynamicMesh3& Mesh) const
+{
+	// Apply PN Tessellation (subdivision) to increase mesh detail
+	if (Settings.IslandTessellationLevel <= 0)
+	{
+		return !IsCancelled();
+	}
+
+	if (Settings.TessellationMode == EIslandTessellationMode::Adaptive)
+	{
+		// Never finer than uniform tessellation at the same level would get, it splits every edge Level + 1 times
+		const double CellSize = (Settings.MaxSpawnDistance + 10000.0) / FMath::Max(Settings.IslandGridResolution, 2);
+
+		FIslandAdaptiveTessellator Tessellator;
+		Tessellator.TriangleBudget = Settings.TessellationTriangleBudget;
+		Tessellator.MinEdgeLength = CellSize / (Settings.IslandTessellationLevel + 1);
+		Tessellator.MaxError = Settings.TessellationMaxError;
+		Tessellator.CancelF = [this]() { return IsCancelled(); };
+		if (!Tessellator.Apply(Mesh))
+		{
+			return false;
+		}
+
+		// Split vertices only carry interpolated normals, which only shading reads
+		return Settings.bCollisionOnly || PostProcess(Mesh, 0, true);
+	}
+
+	// Every level multiplies the triangle count by (Level + 1)^2, take the highest one that fits the budget
+	int32 TessellationLevel = Settings.IslandTessellationLevel;
+	if (Settings.TessellationTriangleBudget > 0)
+	{
+		while (TessellationLevel > 0 && (int64)Mesh.TriangleCount() * FMath::Square(TessellationLevel + 1) > Settings.TessellationTriangleBudget)
+		{
+			--TessellationLevel;
+		}
+	}
+
+	if (TessellationLevel > 0)
+	{
+		FPNTriangles PNTriangles(&Mesh);
+		PNTriangles.TessellationLevel = TessellationLevel;
+		PNTriangles.Compute();
+	}
+
+	return !IsCancelled();
+}
+
+void FIslandMeshBuilder::PlaneCut(FDynamicMesh3& Mesh, const FVector3d& Origin, const FVector3d& Normal, bool bFillHoles) const
+{
+	// Removes everything on the positive side of the plane
+	FMeshPlaneCut Cut(&Mesh, Origin, Normal);
+	Cut.Cut();
+
+	if (bFillHoles)
+	{
+		Cut.HoleFill([](const FGeneralPolygon2d& Polygon) { return ConstrainedDelaunayTriangulate<double>(Polygon); }, false);
+	}
+}
+
+void FIslandMeshBuilder::ProjectUVs(FDynamicMesh3& Mesh) const
+{
+	// Project UVs onto the mesh from a planar projection, one UV tile every UVScale units
+	TArray<int32> Triangles;
+	Triangles.Reserve(Mesh.TriangleCount());
+	for (int32 TriangleID : Mesh.TriangleIndicesItr())
+	{
+		Triangles.Add(TriangleID);
+	}
+
+	FDynamicMeshUVEditor UVEditor(&Mesh, 0, true);
+	UVEditor.SetTriangleUVsFromPlanarProjection(Triangles, [](const FVector3d& Position) { return Position; }, FFrame3d(), FVector2d(Settings.UVScale, Settings.UVScale));
+}
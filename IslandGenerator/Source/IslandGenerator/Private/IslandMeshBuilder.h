@@ -0,0 +1,220 @@
+// The source code, authored by Zoxemik in 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "DynamicMesh/DynamicMesh3.h"
+#include "IslandMeshingMethod.h"
+#include "IslandOverlapMode.h"
+#include "IslandTessellationMode.h"
+#include "IslandGenerationStats.h"
+#include "IslandBiome.h"
+
+class FIslandSurfaceSampler;
+class FIslandTerrainGrid;
+
+DECLARE_STATS_GROUP(TEXT("IslandGenerator"), STATGROUP_IslandGenerator, STATCAT_Advanced);
+
+// Copy of every AIslandConstructor parameter the pipeline reads, so a build never touches the actor
+struct FIslandGenerationSettings
+{
+	FRandomStream Seed;
+
+	int32 MaxNumberOfIslands = 20;
+
+	float IslandHeight = 1300.f;
+
+	float MaxSpawnDistance = 9976.0f;
+
+	FVector2D IslandSize = FVector2D(800.f, 5000.f);
+
+	int32 IslandGridResolution = 50;
+
+	int32 IslandTessellationLevel = 2;
+
+	EIslandTessellationMode TessellationMode = EIslandTessellationMode::Uniform;
+
+	// Most triangles tessellation may leave, 0 means no limit. Uniform mode drops to the highest level that fits
+	int32 TessellationTriangleBudget = 0;
+
+	// Adaptive mode leaves edges whose curve deviates less than this, in world units
+	float TessellationMaxError = 4.0f;
+
+	EIslandMeshingMethod MeshingMethod = EIslandMeshingMethod::VoxelSolidify;
+
+	float ImplicitBlendRadius = 400.f;
+
+	EIslandOverlapMode OverlapMode = EIslandOverlapMode::CullContained;
+
+	// Share of the spawn disc that should be land, islands past it are dropped biggest first. 0 keeps every island
+	float TargetLandCoverage = 0.0f;
+
+	// The implicit surface is already smooth and clipped to the cut planes, so these stages are opt-in there
+	bool bPostProcessImplicitMesh = false;
+
+	int32 SmoothingIterations = 6;
+
+	float SmoothingAlpha = 0.2f;
+
+	// World units per UV tile of the planar projection
+	float UVScale = 100.0f;
+
+	// Dedicated server profile: the same geometry as clients without the normals, UVs and LODs only rendering needs
+	bool bCollisionOnly = false;
+
+	// Number of tiles along X and Y, zero or one on both axes keeps a single mesh
+	FIntPoint TileGridSize = FIntPoint(0, 0);
+
+	bool IsTiled() const { return TileGridSize.X * TileGridSize.Y > 1; }
+
+	// Length of the LOD chain including the full mesh, LOD N is generated at LODResolutionScale^N the grid resolution
+	int32 NumLODs = 1;
+
+	float LODResolutionScale = 0.5f;
+
+	// Cells of the terrain query grid along the longer side of the island bounds, 0 skips the grid
+	int32 TerrainGridResolution = 512;
+
+	FIslandBiomeRules BiomeRules;
+
+	bool bUseMeshCache = false;
+
+	int32 MaxMeshCacheSizeMB = 256;
+
+	// Keeps the mesh after every stage in memory, so a change to a late stage only reruns the stages after it
+	bool bUseStageCache = false;
+
+	int32 MaxStageCacheSizeMB = 256;
+};
+
+// One cone of the archipelago, in actor space
+struct FIslandShape
+{
+	// Center of the island on the water plane (Z = 0)
+	FVector Center = FVector::ZeroVector;
+
+	float Radius = 0.0f;
+
+	float Height = 0.0f;
+};
+
+// One cell of the tiled output, the hash lets unchanged tiles skip re-upload, re-cook and nav dirtying
+struct FIslandMeshTile
+{
+	UE::Geometry::FDynamicMesh3 Mesh;
+
+	uint32 Hash = 0;
+};
+
+struct FIslandBuildResult
+{
+	// Full island mesh, left empty when the output is tiled
+	UE::Geometry::FDynamicMesh3 Mesh;
+
+	// Row-major TileGridSize.X * TileGridSize.Y tiles, empty when the output is not tiled
+	TArray<FIslandMeshTile> Tiles;
+
+	// Upward facing surface of the whole island, for placement that does not wait on the navmesh
+	TSharedPtr<const FIslandSurfaceSampler> Surface;
+
+	// Height, normal and island per cell of the top surface, still in constructor space until the owner places it
+	TSharedPtr<FIslandTerrainGrid> Terrain;
+
+	// True when the mesh was streamed from the mesh cache instead of generated
+	bool bFromCache = false;
+
+	FIslandGenerationStats Stats;
+};
+
+// Times one pipeline stage and records the mesh size once it is done
+class FIslandStageScope
+{
+public:
+	FIslandStageScope(FIslandGenerationStats* InStats, FName InStageName, const UE::Geometry::FDynamicMesh3& InMesh);
+	~FIslandStageScope();
+
+	// Adds a finished stage to the stats and samples the process memory use
+	static void Record(FIslandGenerationStats& Stats, FName StageName, double TimeSeconds, int32 VertexCount, int32 TriangleCount);
+
+private:
+	FIslandGenerationStats* Stats;
+
+	FName StageName;
+
+	const UE::Geometry::FDynamicMesh3& Mesh;
+
+	double StartTime;
+};
+
+// One step of the island pipeline. Key hashes the key of the stage before it with every parameter this stage reads,
+// so the mesh it leaves behind can be memoized and reused by any build that reaches the same key
+struct FIslandPipelineStage
+{
+	FName Name;
+
+	uint64 Key = 0;
+
+	TFunction<bool(UE::Geometry::FDynamicMesh3&)> Run;
+};
+
+// Runs the island pipeline on a plain FDynamicMesh3, without any UObject, so it can be used from a worker thread
+class FIslandMeshBuilder
+{
+public:
+	FIslandMeshBuilder(const FIslandGenerationSettings& InSettings, const TArray<FIslandShape>& InIslands);
+
+	// Rolls the island layout from the seed, consuming the stream in the same order CreateIsland always has,
+	// then resolves overlaps so only cones that add land are left
+	static void BuildLayout(const FIslandGenerationSettings& Settings, TArray<FIslandShape>& OutIslands);
+
+	// Builds the final island mesh into OutMesh. Returns false if the build was cancelled
+	bool Build(UE::Geometry::FDynamicMesh3& OutMesh) const;
+
+	// Builds the mesh, or loads it from the mesh cache, and splits it into tiles if the settings ask for it
+	bool Build(FIslandBuildResult& OutResult) const;
+
+	// Builds one of the coarser LODs, 1 to NumLODs - 1, straight into OutMesh. Returns false if the build was cancelled
+	bool BuildLOD(int32 LODIndex, UE::Geometry::FDynamicMesh3& OutMesh) const;
+
+	// Settings LOD LODIndex is generated with: a coarser grid, no tessellation, tiling or cache
+	static FIslandGenerationSettings MakeLODSettings(const FIslandGenerationSettings& Settings, int32 LODIndex);
+
+	// Rough peak memory of one build with these settings, for scheduling only
+	static int64 EstimatePeakMemory(const FIslandGenerationSettings& Settings);
+
+	// Square every island can reach around the constructor origin, fixed by MaxSpawnDistance alone
+	static UE::Geometry::FAxisAlignedBox2d GetTileFrame(const FIslandGenerationSettings& Settings);
+
+	// Distributes triangles into a grid of tiles over Frame, by triangle centroid. Centroids outside it go to the border tiles
+	static void SplitIntoTiles(const UE::Geometry::FDynamicMesh3& Mesh, FIntPoint GridSize, const UE::Geometry::FAxisAlignedBox2d& Frame, TArray<FIslandMeshTile>& OutTiles);
+
+	// Polled between stages and inside the voxel pass, return true to abort the build
+	TFunction<bool()> CancelF;
+
+private:
+	bool IsCancelled() const;
+
+	bool BuildInternal(FIslandBuildResult& OutResult) const;
+
+	// The stages Build runs for these settings, in order
+	TArray<FIslandPipelineStage> MakeStages() const;
+
+	// Hash of the resolved island layout, the input of the first stage
+	uint64 MakeLayoutKey() const;
+
+	void AppendPrimitives(UE::Geometry::FDynamicMesh3& Mesh) const;
+	void Solidify(UE::Geometry::FDynamicMesh3& Mesh) const;
+	bool MeshImplicit(UE::Geometry::FDynamicMesh3& Mesh) const;
+	bool MeshHeightfield(UE::Geometry::FDynamicMesh3& Mesh) const;
+	bool PostProcess(UE::Geometry::FDynamicMesh3& Mesh, int32 SmoothingIterations, bool bComputeNormals) const;
+	bool Tessellate(UE::Geometry::FDynamicMesh3& Mesh) const;
+	void PlaneCut(UE::Geometry::FDynamicMesh3& Mesh, const FVector3d& Origin, const FVector3d& Normal, bool bFillHoles) const;
+	void ProjectUVs(UE::Geometry::FDynamicMesh3& Mesh) const;
+
+	FIslandGenerationSettings Settings;
+
+	TArray<FIslandShape> Islands;
+
+	// Stats of the build in progress, stages record into it when set
+	mutable FIslandGenerationStats* ActiveStats = nullptr;
+};
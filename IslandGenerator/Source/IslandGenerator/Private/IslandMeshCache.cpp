@@ -0,0 +1,208 @@
+// The source code, authored by Zoxemik in 2025
+
+#include "IslandMeshCache.h"
+#include "IslandMeshBuilder.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "Async/MappedFileHandle.h"
+#include "Hash/xxhash.h"
+#include "Interfaces/IPluginManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+using namespace UE::Geometry;
+
+namespace IslandMeshCache
+{
+	static constexpr uint32 Magic = 0x49534C43; // "ISLC"
+
+	// Bump whenever the pipeline changes its output for the same parameters
+	static constexpr int32 FormatVersion = 4;
+
+	static FString GetPluginVersion()
+	{
+		TSharedPtr<IPlugin> Plugin = IPluginManager::Get().FindPlugin(TEXT("IslandGenerator"));
+		return Plugin.IsValid() ? Plugin->GetDescriptor().VersionName : FString();
+	}
+}
+
+FString FIslandMeshCache::GetCacheDirectory()
+{
+	return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("IslandCache"));
+}
+
+FString FIslandMeshCache::GetEntryPath(uint64 Key)
+{
+	return FPaths::Combine(GetCacheDirectory(), FString::Printf(TEXT("%016llx.islandmesh"), Key));
+}
+
+uint64 FIslandMeshCache::MakeKey(const FIslandGenerationSettings& Settings)
+{
+	TArray<uint8> KeyData;
+	FMemoryWriter Writer(KeyData);
+
+	int32 FormatVersion = IslandMeshCache::FormatVersion;
+	FString PluginVersion = IslandMeshCache::GetPluginVersion();
+	int32 SeedValue = Settings.Seed.GetCurrentSeed();
+	int32 MaxNumberOfIslands = Settings.MaxNumberOfIslands;
+	FVector2D IslandSize = Settings.IslandSize;
+	float IslandHeight = Settings.IslandHeight;
+	float MaxSpawnDistance = Settings.MaxSpawnDistance;
+	int32 IslandGridResolution = Settings.IslandGridResolution;
+	int32 IslandTessellationLevel = Settings.IslandTessellationLevel;
+	uint8 MeshingMethod = (uint8)Settings.MeshingMethod;
+	float ImplicitBlendRadius = Settings.ImplicitBlendRadius;
+	bool bPostProcessImplicitMesh = Settings.bPostProcessImplicitMesh;
+	bool bCollisionOnly = Settings.bCollisionOnly;
+	uint8 OverlapMode = (uint8)Settings.OverlapMode;
+	uint8 TessellationMode = (uint8)Settings.TessellationMode;
+	int32 TessellationTriangleBudget = Settings.TessellationTriangleBudget;
+	float TessellationMaxError = Settings.TessellationMaxError;
+	float TargetLandCoverage = Settings.TargetLandCoverage;
+	int32 SmoothingIterations = Settings.SmoothingIterations;
+	float SmoothingAlpha = Settings.SmoothingAlpha;
+	float UVScale = Settings.UVScale;
+
+	Writer << FormatVersion << PluginVersion << SeedValue << MaxNumberOfIslands << IslandSize << IslandHeight << MaxSpawnDistance;
+	Writer << IslandGridResolution << IslandTessellationLevel << MeshingMethod << ImplicitBlendRadius << bPostProcessImplicitMesh << bCollisionOnly;
+	Writer << OverlapMode << TargetLandCoverage << TessellationMode << TessellationTriangleBudget << TessellationMaxError;
+	Writer << SmoothingIterations << SmoothingAlpha << UVScale;
+
+	return FXxHash64::HashBuffer(KeyData.GetData(), KeyData.Num()).Hash;
+}
+
+bool FIslandMeshCache::Load(uint64 Key, FDynamicMesh3& OutMesh, TArray<FVector>& OutSpawnPoints)
+{
+	const FString Path = GetEntryPath(Key);
+	if (!IFileManager::Get().FileExists(*Path))
+	{
+		return false;
+	}
+
+	auto ReadEntry = [Key, &OutMesh, &OutSpawnPoints](FArchive& Reader)
+	{
+		uint32 Magic = 0;
+		int32 FormatVersion = 0;
+		uint64 StoredKey = 0;
+		Reader << Magic << FormatVersion << StoredKey;
+		if (Reader.IsError() || Magic != IslandMeshCache::Magic || FormatVersion != IslandMeshCache::FormatVersion || StoredKey != Key)
+		{
+			return false;
+		}
+
+		Reader << OutSpawnPoints;
+		Reader << OutMesh;
+		return !Reader.IsError();
+	};
+
+	bool bLoaded = false;
+
+	// Stream straight out of a mapping when the platform gives us one, no intermediate copy of the file
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+	TUniquePtr<IMappedFileHandle> MappedFile(PlatformFile.OpenMapped(*Path));
+	if (MappedFile.IsValid())
+	{
+		TUniquePtr<IMappedFileRegion> Region(MappedFile->MapRegion(0, MappedFile->GetFileSize()));
+		if (Region.IsValid())
+		{
+			FMemoryReaderView Reader(MakeArrayView(Region->GetMappedPtr(), (int32)Region->GetMappedSize()));
+			bLoaded = ReadEntry(Reader);
+		}
+	}
+	else
+	{
+		TArray<uint8> FileData;
+		if (FFileHelper::LoadFileToArray(FileData, *Path))
+		{
+			FMemoryReader Reader(FileData);
+			bLoaded = ReadEntry(Reader);
+		}
+	}
+
+	if (!bLoaded)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Island mesh cache entry %s is unreadable, regenerating"), *Path);
+		OutMesh.Clear();
+		OutSpawnPoints.Empty();
+		IFileManager::Get().Delete(*Path, false, true, true);
+		return false;
+	}
+
+	// Mark the entry as recently used for eviction
+	IFileManager::Get().SetTimeStamp(*Path, FDateTime::UtcNow());
+	return true;
+}
+
+void FIslandMeshCache::Save(uint64 Key, const FDynamicMesh3& Mesh, const TArray<FVector>& SpawnPoints, int32 MaxSizeMB)
+{
+	TArray<uint8> FileData;
+	FMemoryWriter Writer(FileData);
+
+	uint32 Magic = IslandMeshCache::Magic;
+	int32 FormatVersion = IslandMeshCache::FormatVersion;
+	Writer << Magic << FormatVersion << Key;
+	Writer << const_cast<TArray<FVector>&>(SpawnPoints);
+	// Saving archives never write to the object
+	Writer << const_cast<FDynamicMesh3&>(Mesh);
+
+	if (MaxSizeMB > 0 && FileData.Num() > (int64)MaxSizeMB * 1024 * 1024)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Island mesh is larger than the whole mesh cache, not caching it"));
+		return;
+	}
+
+	// Write to a unique temp file first so a concurrent reader never sees half an entry
+	const FString Path = GetEntryPath(Key);
+	const FString TempPath = Path + TEXT(".") + FGuid::NewGuid().ToString() + TEXT(".tmp");
+	if (!FFileHelper::SaveArrayToFile(FileData, *TempPath) || !IFileManager::Get().Move(*Path, *TempPath, true, true))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Failed to write island mesh cache entry %s"), *Path);
+		IFileManager::Get().Delete(*TempPath, false, true, true);
+		return;
+	}
+
+	if (MaxSizeMB > 0)
+	{
+		Evict((int64)MaxSizeMB * 1024 * 1024);
+	}
+}
+
+void FIslandMeshCache::Evict(int64 MaxSizeBytes)
+{
+	struct FEntry
+	{
+		FString Path;
+		int64 Size;
+		FDateTime LastUsed;
+	};
+
+	TArray<FEntry> Entries;
+	int64 TotalSize = 0;
+	IFileManager::Get().IterateDirectoryStat(*GetCacheDirectory(), [&Entries, &TotalSize](const TCHAR* Path, const FFileStatData& StatData)
+	{
+		if (!StatData.bIsDirectory && FPaths::GetExtension(Path) == TEXT("islandmesh"))
+		{
+			Entries.Add({ Path, StatData.FileSize, StatData.ModificationTime });
+			TotalSize += StatData.FileSize;
+		}
+		return true;
+	});
+
+	// Oldest first
+	Entries.Sort([](const FEntry& A, const FEntry& B) { return A.LastUsed < B.LastUsed; });
+
+	for (const FEntry& Entry : Entries)
+	{
+		if (TotalSize <= MaxSizeBytes)
+		{
+			break;
+		}
+
+		if (IFileManager::Get().Delete(*Entry.Path, false, true, true))
+		{
+			TotalSize -= Entry.Size;
+		}
+	}
+}
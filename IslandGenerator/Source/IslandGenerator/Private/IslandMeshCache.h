@@ -0,0 +1,30 @@
+// The source code, authored by Zoxemik in 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "DynamicMesh/DynamicMesh3.h"
+
+struct FIslandGenerationSettings;
+
+// On-disk cache of finished island meshes, keyed by a hash of the seed and every parameter that shapes the mesh.
+// All functions are safe to call from worker threads
+class FIslandMeshCache
+{
+public:
+	// Content key for the settings, changes whenever the generated mesh could change
+	static uint64 MakeKey(const FIslandGenerationSettings& Settings);
+
+	// Reads a cached mesh and its spawn points, memory-mapping the file where the platform supports it
+	static bool Load(uint64 Key, UE::Geometry::FDynamicMesh3& OutMesh, TArray<FVector>& OutSpawnPoints);
+
+	// Writes a cache entry, then evicts the least recently used entries until the cache fits in MaxSizeMB
+	static void Save(uint64 Key, const UE::Geometry::FDynamicMesh3& Mesh, const TArray<FVector>& SpawnPoints, int32 MaxSizeMB);
+
+	static FString GetCacheDirectory();
+
+private:
+	static FString GetEntryPath(uint64 Key);
+
+	static void Evict(int64 MaxSizeBytes);
+};
@@ -0,0 +1,280 @@
+// The source code, authored by Zoxemik in 2025
+
+#include "IslandMeshPostProcessor.h"
+#include "DynamicMesh/DynamicMeshAttributeSet.h"
+#include "Async/ParallelFor.h"
+
+using namespace UE::Geometry;
+
+namespace IslandPostProcess
+{
+	// Items per ParallelFor task, large enough that scheduling never shows up next to the kernels
+	static constexpr int32 ChunkSize = 2048;
+
+	template<typename FunctionType>
+	static void ParallelForChunks(int32 Num, FunctionType&& Function)
+	{
+		const int32 NumChunks = FMath::DivideAndRoundUp(Num, ChunkSize);
+		ParallelFor(NumChunks, [&](int32 Chunk)
+		{
+			const int32 Begin = Chunk * ChunkSize;
+			const int32 End = FMath::Min(Begin + ChunkSize, Num);
+			Function(Begin, End);
+		});
+	}
+}
+
+bool FIslandMeshPostProcessor::IsCancelled() const
+{
+	return CancelF && CancelF();
+}
+
+bool FIslandMeshPostProcessor::Apply(FDynamicMesh3& Mesh) const
+{
+	if ((SmoothingIterations <= 0 && !bComputeNormals) || Mesh.VertexCount() == 0)
+	{
+		return !IsCancelled();
+	}
+
+	FPackedMesh Packed;
+	Pack(Mesh, Packed);
+	if (IsCancelled()) { return false; }
+
+	// Normals come from the unsmoothed positions, the order the pipeline has always run them in
+	TArray<FVector3f> Normals;
+	if (bComputeNormals)
+	{
+#if DO_CHECK
+		// Thread-safe one-time init, several builds can post-process at once
+		static const bool bWindingChecked = (CheckNormalWinding(), true);
+		(void)bWindingChecked;
+#endif
+		ComputeNormals(Packed, Normals);
+		if (IsCancelled()) { return false; }
+	}
+
+	if (!Smooth(Packed)) { return false; }
+
+	// Single write back of everything that changed
+	if (SmoothingIterations > 0)
+	{
+		for (int32 Index = 0; Index < Packed.VertexIDs.Num(); ++Index)
+		{
+			const FVector4f& Position = Packed.Positions[Index];
+			Mesh.SetVertex(Packed.VertexIDs[Index], FVector3d(Position.X, Position.Y, Position.Z));
+		}
+	}
+
+	if (bComputeNormals)
+	{
+		if (!Mesh.HasAttributes())
+		{
+			Mesh.EnableAttributes();
+		}
+
+		// One shared element per vertex, same layout InitializeOverlayToPerVertexNormals produces
+		FDynamicMeshNormalOverlay* Overlay = Mesh.Attributes()->PrimaryNormals();
+		Overlay->ClearElements();
+
+		TArray<int32> ElementIDs;
+		ElementIDs.SetNumUninitialized(Normals.Num());
+		for (int32 Index = 0; Index < Normals.Num(); ++Index)
+		{
+			ElementIDs[Index] = Overlay->AppendElement(Normals[Index]);
+		}
+
+		for (int32 Index = 0; Index < Packed.TriangleIDs.Num(); ++Index)
+		{
+			const FIntVector3& Triangle = Packed.Triangles[Index];
+			Overlay->SetTriangle(Packed.TriangleIDs[Index], FIndex3i(ElementIDs[Triangle.X], ElementIDs[Triangle.Y], ElementIDs[Triangle.Z]));
+		}
+	}
+
+	return !IsCancelled();
+}
+
+void FIslandMeshPostProcessor::Pack(const FDynamicMesh3& Mesh, FPackedMesh& Packed) const
+{
+	const int32 NumVertices = Mesh.VertexCount();
+
+	Packed.VertexIDs.Reset(NumVertices);
+	Packed.DenseIndices.Init(INDEX_NONE, Mesh.MaxVertexID());
+	for (int32 VertexID : Mesh.VertexIndicesItr())
+	{
+		Packed.DenseIndices[VertexID] = Packed.VertexIDs.Add(VertexID);
+	}
+
+	// Row sizes first, then the rows themselves in parallel, every vertex writes only its own slice
+	Packed.Positions.SetNumUninitialized(NumVertices);
+	Packed.RingOffsets.SetNumUninitialized(NumVertices + 1);
+	IslandPostProcess::ParallelForChunks(NumVertices, [&](int32 Begin, int32 End)
+	{
+		for (int32 Index = Begin; Index < End; ++Index)
+		{
+			const int32 VertexID = Packed.VertexIDs[Index];
+			const FVector3d Position = Mesh.GetVertex(VertexID);
+			Packed.Positions[Index] = FVector4f((float)Position.X, (float)Position.Y, (float)Position.Z, 0.0f);
+			Packed.RingOffsets[Index + 1] = Mesh.GetVtxEdgeCount(VertexID);
+		}
+	});
+
+	Packed.RingOffsets[0] = 0;
+	for (int32 Index = 0; Index < NumVertices; ++Index)
+	{
+		Packed.RingOffsets[Index + 1] += Packed.RingOffsets[Index];
+	}
+
+	Packed.Rings.SetNumUninitialized(Packed.RingOffsets[NumVertices]);
+	IslandPostProcess::ParallelForChunks(NumVertices, [&](int32 Begin, int32 End)
+	{
+		for (int32 Index = Begin; Index < End; ++Index)
+		{
+			int32 Write = Packed.RingOffsets[Index];
+			for (int32 NeighborID : Mesh.VtxVerticesItr(Packed.VertexIDs[Index]))
+			{
+				Packed.Rings[Write++] = Packed.DenseIndices[NeighborID];
+			}
+		}
+	});
+
+	if (!bComputeNormals)
+	{
+		return;
+	}
+
+	Packed.TriangleIDs.Reset(Mesh.TriangleCount());
+	Packed.Triangles.Reset(Mesh.TriangleCount());
+	Packed.VertexTriangleOffsets.Init(0, NumVertices + 1);
+	for (int32 TriangleID : Mesh.TriangleIndicesItr())
+	{
+		const FIndex3i Triangle = Mesh.GetTriangle(TriangleID);
+		const FIntVector3 Dense(Packed.DenseIndices[Triangle.A], Packed.DenseIndices[Triangle.B], Packed.DenseIndices[Triangle.C]);
+		Packed.TriangleIDs.Add(TriangleID);
+		Packed.Triangles.Add(Dense);
+		++Packed.VertexTriangleOffsets[Dense.X + 1];
+		++Packed.VertexTriangleOffsets[Dense.Y + 1];
+		++Packed.VertexTriangleOffsets[Dense.Z + 1];
+	}
+
+	for (int32 Index = 0; Index < NumVertices; ++Index)
+	{
+		Packed.VertexTriangleOffsets[Index + 1] += Packed.VertexTriangleOffsets[Index];
+	}
+
+	TArray<int32> Cursors(Packed.VertexTriangleOffsets.GetData(), NumVertices);
+	Packed.VertexTriangles.SetNumUninitialized(Packed.VertexTriangleOffsets[NumVertices]);
+	for (int32 Index = 0; Index < Packed.Triangles.Num(); ++Index)
+	{
+		const FIntVector3& Triangle = Packed.Triangles[Index];
+		Packed.VertexTriangles[Cursors[Triangle.X]++] = Index;
+		Packed.VertexTriangles[Cursors[Triangle.Y]++] = Index;
+		Packed.VertexTriangles[Cursors[Triangle.Z]++] = Index;
+	}
+}
+
+void FIslandMeshPostProcessor::ComputeNormals(const FPackedMesh& Packed, TArray<FVector3f>& OutNormals) const
+{
+	// Unnormalized face normals, their length is twice the triangle area so the vertex sum is area weighted
+	TArray<FVector4f> FaceNormals;
+	FaceNormals.SetNumUninitialized(Packed.Triangles.Num());
+	IslandPostProcess::ParallelForChunks(Packed.Triangles.Num(), [&](int32 Begin, int32 End)
+	{
+		for (int32 Index = Begin; Index < End; ++Index)
+		{
+			const FIntVector3& Triangle = Packed.Triangles[Index];
+			const VectorRegister4Float A = VectorLoadAligned(&Packed.Positions[Triangle.X].X);
+			const VectorRegister4Float B = VectorLoadAligned(&Packed.Positions[Triangle.Y].X);
+			const VectorRegister4Float C = VectorLoadAligned(&Packed.Positions[Triangle.Z].X);
+			// (C - A) x (B - A), the engine's left-handed winding, same as VectorUtil::Normal
+			VectorStoreAligned(VectorCross(VectorSubtract(C, A), VectorSubtract(B, A)), &FaceNormals[Index].X);
+		}
+	});
+
+	// Gather rather than scatter, so no two tasks ever write the same vertex
+	OutNormals.SetNumUninitialized(Packed.Positions.Num());
+	IslandPostProcess::ParallelForChunks(Packed.Positions.Num(), [&](int32 Begin, int32 End)
+	{
+		for (int32 Index = Begin; Index < End; ++Index)
+		{
+			VectorRegister4Float Sum = VectorZeroFloat();
+			for (int32 Row = Packed.VertexTriangleOffsets[Index]; Row < Packed.VertexTriangleOffsets[Index + 1]; ++Row)
+			{
+				Sum = VectorAdd(Sum, VectorLoadAligned(&FaceNormals[Packed.VertexTriangles[Row]].X));
+			}
+
+			FVector4f Normal;
+			VectorStoreAligned(Sum, &Normal.X);
+			OutNormals[Index] = FVector3f(Normal.X, Normal.Y, Normal.Z).GetSafeNormal(UE_SMALL_NUMBER, FVector3f::UnitZ());
+		}
+	});
+}
+
+void FIslandMeshPostProcessor::CheckNormalWinding() const
+{
+	// A flat quad wound the way the meshers emit up-facing triangles has to come out facing +Z
+	FDynamicMesh3 Quad;
+	const int32 V00 = Quad.AppendVertex(FVector3d(0.0, 0.0, 0.0));
+	const int32 V10 = Quad.AppendVertex(FVector3d(1.0, 0.0, 0.0));
+	const int32 V01 = Quad.AppendVertex(FVector3d(0.0, 1.0, 0.0));
+	const int32 V11 = Quad.AppendVertex(FVector3d(1.0, 1.0, 0.0));
+	Quad.AppendTriangle(V00, V11, V10);
+	Quad.AppendTriangle(V00, V01, V11);
+
+	FPackedMesh Packed;
+	Pack(Quad, Packed);
+	TArray<FVector3f> Normals;
+	ComputeNormals(Packed, Normals);
+	for (const FVector3f& Normal : Normals)
+	{
+		ensureMsgf(Normal.Z > 0.99f, TEXT("Flat up-facing quad got normal %s, the face normal winding is inverted"), *Normal.ToString());
+	}
+}
+
+bool FIslandMeshPostProcessor::Smooth(FPackedMesh& Packed) const
+{
+	if (SmoothingIterations <= 0)
+	{
+		return true;
+	}
+
+	// Ping-pong between two buffers, every iteration reads only the previous one
+	TArray<FVector4f> Smoothed;
+	Smoothed.SetNumUninitialized(Packed.Positions.Num());
+
+	const VectorRegister4Float Alpha = VectorSetFloat1(SmoothingAlpha);
+
+	for (int32 Iteration = 0; Iteration < SmoothingIterations; ++Iteration)
+	{
+		const TArray<FVector4f>& Source = Packed.Positions;
+		IslandPostProcess::ParallelForChunks(Source.Num(), [&](int32 Begin, int32 End)
+		{
+			for (int32 Index = Begin; Index < End; ++Index)
+			{
+				const int32 RowBegin = Packed.RingOffsets[Index];
+				const int32 RowEnd = Packed.RingOffsets[Index + 1];
+				const VectorRegister4Float Position = VectorLoadAligned(&Source[Index].X);
+
+				if (RowBegin == RowEnd)
+				{
+					VectorStoreAligned(Position, &Smoothed[Index].X);
+					continue;
+				}
+
+				VectorRegister4Float Sum = VectorZeroFloat();
+				for (int32 Row = RowBegin; Row < RowEnd; ++Row)
+				{
+					Sum = VectorAdd(Sum, VectorLoadAligned(&Source[Packed.Rings[Row]].X));
+				}
+
+				// Lerp towards the uniform centroid of the one-ring
+				const VectorRegister4Float Centroid = VectorMultiply(Sum, VectorSetFloat1(1.0f / (RowEnd - RowBegin)));
+				VectorStoreAligned(VectorMultiplyAdd(VectorSubtract(Centroid, Position), Alpha, Position), &Smoothed[Index].X);
+			}
+		});
+
+		Swap(Packed.Positions, Smoothed);
+		if (IsCancelled()) { return false; }
+	}
+
+	return true;
+}
@@ -0,0 +1,58 @@
+// The source code, authored by Zoxemik in 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "DynamicMesh/DynamicMesh3.h"
+
+// Per-vertex normals and uniform Laplacian smoothing on flat buffers. Positions, the one-ring and the vertex-triangle
+// adjacency are packed once into compressed rows, the kernels run over them on every core four floats at a time,
+// and the mesh is written back once at the end instead of after every iteration
+class FIslandMeshPostProcessor
+{
+public:
+	// Iterations of moving every vertex towards the centroid of its one-ring, 0 skips smoothing
+	int32 SmoothingIterations = 6;
+
+	float SmoothingAlpha = 0.2f;
+
+	// Area weighted per-vertex normals into the primary normal overlay, from the positions before smoothing
+	bool bComputeNormals = true;
+
+	TFunction<bool()> CancelF;
+
+	// Returns false if cancelled, the mesh is left untouched then
+	bool Apply(UE::Geometry::FDynamicMesh3& Mesh) const;
+
+private:
+	bool IsCancelled() const;
+
+	struct FPackedMesh
+	{
+		// Dense index to vertex ID, and back
+		TArray<int32> VertexIDs;
+		TArray<int32> DenseIndices;
+
+		// XYZ in the first three lanes, so every position is a single aligned vector load
+		TArray<FVector4f> Positions;
+
+		// Compressed rows: the neighbors of dense vertex I are Rings[RingOffsets[I]] .. Rings[RingOffsets[I + 1] - 1]
+		TArray<int32> RingOffsets;
+		TArray<int32> Rings;
+
+		// Triangles by dense corner, and the compressed rows of triangles around every vertex
+		TArray<int32> TriangleIDs;
+		TArray<FIntVector3> Triangles;
+		TArray<int32> VertexTriangleOffsets;
+		TArray<int32> VertexTriangles;
+	};
+
+	void Pack(const UE::Geometry::FDynamicMesh3& Mesh, FPackedMesh& Packed) const;
+
+	void ComputeNormals(const FPackedMesh& Packed, TArray<FVector3f>& OutNormals) const;
+
+	// Runs once in builds with checks, ensures the face normal winding makes a flat up-facing quad point up
+	void CheckNormalWinding() const;
+
+	bool Smooth(FPackedMesh& Packed) const;
+};
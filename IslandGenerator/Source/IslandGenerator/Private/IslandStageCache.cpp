@@ -0,0 +1,119 @@
+// The source code, authored by Zoxemik in 2025
+
+#include "IslandStageCache.h"
+#include "Misc/ScopeLock.h"
+
+using namespace UE::Geometry;
+
+namespace IslandStageCache
+{
+	struct FEntry
+	{
+		TSharedPtr<const FDynamicMesh3> Mesh;
+
+		int64 SizeBytes = 0;
+
+		uint64 LastUsed = 0;
+	};
+
+	struct FState
+	{
+		FCriticalSection Lock;
+
+		TMap<uint64, FEntry> Entries;
+
+		int64 TotalSizeBytes = 0;
+
+		uint64 UseCounter = 0;
+	};
+
+	static FState& Get()
+	{
+		static FState State;
+		return State;
+	}
+
+	// Close enough for a budget: positions, topology and one normal and UV element per vertex
+	static int64 EstimateSize(const FDynamicMesh3& Mesh)
+	{
+		return (int64)Mesh.MaxVertexID() * 96 + (int64)Mesh.MaxTriangleID() * 64 + (int64)Mesh.MaxEdgeID() * 32;
+	}
+}
+
+bool FIslandStageCache::Find(uint64 Key, FDynamicMesh3& OutMesh)
+{
+	IslandStageCache::FState& State = IslandStageCache::Get();
+
+	TSharedPtr<const FDynamicMesh3> Mesh;
+	{
+		FScopeLock ScopeLock(&State.Lock);
+		IslandStageCache::FEntry* Entry = State.Entries.Find(Key);
+		if (!Entry)
+		{
+			return false;
+		}
+
+		Entry->LastUsed = ++State.UseCounter;
+		Mesh = Entry->Mesh;
+	}
+
+	// Entries are immutable, copy outside the lock
+	OutMesh = *Mesh;
+	return true;
+}
+
+void FIslandStageCache::Store(uint64 Key, const FDynamicMesh3& Mesh, int32 MaxSizeMB)
+{
+	const int64 MaxSizeBytes = (int64)MaxSizeMB * 1024 * 1024;
+	const int64 SizeBytes = IslandStageCache::EstimateSize(Mesh);
+	if (MaxSizeMB > 0 && SizeBytes > MaxSizeBytes)
+	{
+		return;
+	}
+
+	TSharedPtr<const FDynamicMesh3> Copy = MakeShared<const FDynamicMesh3>(Mesh);
+
+	IslandStageCache::FState& State = IslandStageCache::Get();
+	FScopeLock ScopeLock(&State.Lock);
+
+	if (IslandStageCache::FEntry* Existing = State.Entries.Find(Key))
+	{
+		State.TotalSizeBytes -= Existing->SizeBytes;
+	}
+
+	IslandStageCache::FEntry& Entry = State.Entries.Add(Key);
+	Entry.Mesh = MoveTemp(Copy);
+	Entry.SizeBytes = SizeBytes;
+	Entry.LastUsed = ++State.UseCounter;
+	State.TotalSizeBytes += SizeBytes;
+
+	if (MaxSizeMB <= 0)
+	{
+		return;
+	}
+
+	while (State.TotalSizeBytes > MaxSizeBytes && State.Entries.Num() > 1)
+	{
+		// Few enough entries that a linear scan for the oldest is cheaper than keeping them ordered
+		uint64 OldestKey = 0;
+		uint64 OldestUse = MAX_uint64;
+		for (const TPair<uint64, IslandStageCache::FEntry>& Pair : State.Entries)
+		{
+			if (Pair.Value.LastUsed < OldestUse)
+			{
+				OldestKey = Pair.Key;
+				OldestUse = Pair.Value.LastUsed;
+			}
+		}
+
+		State.TotalSizeBytes -= State.Entries.FindAndRemoveChecked(OldestKey).SizeBytes;
+	}
+}
+
+void FIslandStageCache::Clear()
+{
+	IslandStageCache::FState& State = IslandStageCache::Get();
+	FScopeLock ScopeLock(&State.Lock);
+	State.Entries.Empty();
+	State.TotalSizeBytes = 0;
+}
@@ -0,0 +1,48 @@
+// The source code, authored by Zoxemik in 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "DynamicMesh/DynamicMesh3.h"
+#include "Hash/xxhash.h"
+
+// Key of one pipeline stage's output: the key of its input mesh chained with the stage's own parameters,
+// so two equal keys always stand for the same mesh
+class FIslandStageKey
+{
+public:
+	explicit FIslandStageKey(uint64 InputKey)
+	{
+		Builder.Update(&InputKey, sizeof(InputKey));
+	}
+
+	template<typename ValueType>
+	FIslandStageKey& Add(const ValueType& Value)
+	{
+		static_assert(TIsPODType<ValueType>::Value, "Stage parameters are hashed by value");
+		Builder.Update(&Value, sizeof(Value));
+		return *this;
+	}
+
+	uint64 Finalize() const
+	{
+		return Builder.Finalize().Hash;
+	}
+
+private:
+	FXxHash64Builder Builder;
+};
+
+// In-memory cache of intermediate pipeline meshes, shared by every build in the process and evicted least recently
+// used first. All functions are safe to call from worker threads
+class FIslandStageCache
+{
+public:
+	// Copies the mesh stored under Key into OutMesh
+	static bool Find(uint64 Key, UE::Geometry::FDynamicMesh3& OutMesh);
+
+	// Stores a copy of the mesh, then evicts until the cache fits in MaxSizeMB
+	static void Store(uint64 Key, const UE::Geometry::FDynamicMesh3& Mesh, int32 MaxSizeMB);
+
+	static void Clear();
+};
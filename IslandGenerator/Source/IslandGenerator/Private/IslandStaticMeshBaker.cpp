@@ -0,0 +1,68 @@
+// The source code, authored by Zoxemik in 2025
+
+#include "IslandStaticMeshBaker.h"
+#include "Engine/StaticMesh.h"
+#include "PhysicsEngine/BodySetup.h"
+#include "Materials/MaterialInterface.h"
+#include "MeshDescription.h"
+#include "StaticMeshAttributes.h"
+#include "DynamicMeshToMeshDescription.h"
+
+using namespace UE::Geometry;
+
+UStaticMesh* FIslandStaticMeshBaker::Bake(UObject* Outer, const FDynamicMesh3& Mesh, const TArray<UMaterialInterface*>& Materials, bool bWithCollision)
+{
+	if (Mesh.TriangleCount() == 0)
+	{
+		return nullptr;
+	}
+
+	FMeshDescription MeshDescription;
+	FStaticMeshAttributes Attributes(MeshDescription);
+	Attributes.Register();
+
+	// Polygroups and vertex colors are never read by the island material
+	FConversionToMeshDescriptionOptions ConversionOptions;
+	ConversionOptions.bSetPolyGroups = false;
+	ConversionOptions.bUpdateVtxColors = false;
+
+	FDynamicMeshToMeshDescription Converter(ConversionOptions);
+	Converter.Convert(&Mesh, MeshDescription, false);
+
+	UStaticMesh* StaticMesh = NewObject<UStaticMesh>(Outer, NAME_None, RF_Transient);
+	for (UMaterialInterface* Material : Materials)
+	{
+		StaticMesh->GetStaticMaterials().Add(FStaticMaterial(Material));
+	}
+	if (StaticMesh->GetStaticMaterials().Num() == 0)
+	{
+		StaticMesh->GetStaticMaterials().Add(FStaticMaterial());
+	}
+
+	// Half precision UVs and 8 bit tangents are the vertex buffer defaults, nothing is kept for re-editing
+	UStaticMesh::FBuildMeshDescriptionsParams BuildParams;
+	BuildParams.bMarkPackageDirty = false;
+	BuildParams.bUseHashAsGuid = true;
+	BuildParams.bBuildSimpleCollision = false;
+	BuildParams.bCommitMeshDescription = false;
+	BuildParams.bFastBuild = true;
+	BuildParams.bAllowCpuAccess = bWithCollision;
+
+	if (!StaticMesh->BuildFromMeshDescriptions({ &MeshDescription }, BuildParams))
+	{
+		UE_LOG(LogTemp, Error, TEXT("Baking the island into a static mesh failed"));
+		return nullptr;
+	}
+
+	if (bWithCollision)
+	{
+		// The island is far from convex, the render triangles are the collision like on the dynamic mesh component
+		StaticMesh->CreateBodySetup();
+		UBodySetup* BodySetup = StaticMesh->GetBodySetup();
+		BodySetup->CollisionTraceFlag = CTF_UseComplexAsSimple;
+		BodySetup->InvalidatePhysicsData();
+		BodySetup->CreatePhysicsMeshes();
+	}
+
+	return StaticMesh;
+}
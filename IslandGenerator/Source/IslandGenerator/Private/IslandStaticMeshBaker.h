@@ -0,0 +1,18 @@
+// The source code, authored by Zoxemik in 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "DynamicMesh/DynamicMesh3.h"
+
+class UStaticMesh;
+class UMaterialInterface;
+
+// Bakes a finished island mesh into a transient runtime static mesh, so the editable FDynamicMesh3 can be released
+class FIslandStaticMeshBaker
+{
+public:
+	// Only positions, normals, tangents and the first UV channel are kept, in the engine's packed vertex formats.
+	// With collision the mesh keeps CPU access and cooks complex-as-simple collision from its own triangles
+	static UStaticMesh* Bake(UObject* Outer, const UE::Geometry::FDynamicMesh3& Mesh, const TArray<UMaterialInterface*>& Materials, bool bWithCollision);
+};
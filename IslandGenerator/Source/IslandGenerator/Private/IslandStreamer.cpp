@@ -0,0 +1,206 @@
+// The source code, authored by Zoxemik in 2025
+
+#include "IslandStreamer.h"
+#include "IslandConstructor.h"
+#include "IslandPluginInterface.h"
+#include "Spawner.h"
+#include "TimerManager.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "Kismet/GameplayStatics.h"
+
+AIslandStreamer::AIslandStreamer()
+{
+	PrimaryActorTick.bCanEverTick = false;
+
+	RootComponent = CreateDefaultSubobject<USceneComponent>(TEXT("SceneComponent"));
+
+	Seed.Initialize(0);
+
+	CellSize = 20000.0f;
+
+	LoadRadius = 1;
+
+	UnloadRadius = 2;
+
+	MaxCellLoadsPerUpdate = 1;
+
+	UpdateInterval = 0.5f;
+}
+
+void AIslandStreamer::BeginPlay()
+{
+	Super::BeginPlay();
+
+	UGameInstance* GameInstance = UGameplayStatics::GetGameInstance(this);
+	if (GameInstance->GetClass()->ImplementsInterface(UIslandPluginInterface::StaticClass()))
+	{
+		// Retrieve the world seed from the game instance
+		Seed = IIslandPluginInterface::Execute_IslandSeed(GameInstance);
+	}
+
+	FTimerDelegate UpdateDelegate;
+	UpdateDelegate.BindUFunction(this, FName("UpdateCells"));
+	GetWorld()->GetTimerManager().SetTimer(UpdateHandle, UpdateDelegate, UpdateInterval, true, 0.0f);
+}
+
+void AIslandStreamer::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	GetWorld()->GetTimerManager().ClearTimer(UpdateHandle);
+
+	for (TPair<FIntPoint, FIslandStreamCell>& Pair : Cells)
+	{
+		ReleaseCell(Pair.Value);
+	}
+	Cells.Empty();
+
+	Super::EndPlay(EndPlayReason);
+}
+
+#if WITH_EDITOR
+void AIslandStreamer::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	// Below LoadRadius, cells at the border would load and unload on every update
+	UnloadRadius = FMath::Max(UnloadRadius, LoadRadius);
+}
+#endif
+
+FIntPoint AIslandStreamer::GetCellAt(const FVector& Location) const
+{
+	// Cells are centered on multiples of CellSize
+	return FIntPoint(FMath::RoundToInt32(Location.X / CellSize), FMath::RoundToInt32(Location.Y / CellSize));
+}
+
+FRandomStream AIslandStreamer::MakeCellSeed(const FIntPoint& Cell) const
+{
+	const uint32 Hash = HashCombineFast(GetTypeHash(Seed.GetInitialSeed()), GetTypeHash(Cell));
+	return FRandomStream((int32)Hash);
+}
+
+void AIslandStreamer::UpdateCells()
+{
+	UWorld* World = GetWorld();
+	if (!World) { return; }
+
+	TArray<FVector> ViewLocations;
+	for (FConstPlayerControllerIterator It = World->GetPlayerControllerIterator(); It; ++It)
+	{
+		if (APlayerController* PlayerController = It->Get())
+		{
+			FVector ViewLocation;
+			FRotator ViewRotation;
+			PlayerController->GetPlayerViewPoint(ViewLocation, ViewRotation);
+			ViewLocations.Add(ViewLocation);
+		}
+	}
+
+	// A wanted cell must never be released in the same update, whatever Blueprints set at runtime
+	const int32 KeepRadius = FMath::Max(UnloadRadius, LoadRadius);
+
+	TSet<FIntPoint> WantedCells;
+	TSet<FIntPoint> KeptCells;
+	for (const FVector& ViewLocation : ViewLocations)
+	{
+		const FIntPoint Center = GetCellAt(ViewLocation);
+		for (int32 Y = -KeepRadius; Y <= KeepRadius; ++Y)
+		{
+			for (int32 X = -KeepRadius; X <= KeepRadius; ++X)
+			{
+				KeptCells.Add(Center + FIntPoint(X, Y));
+				if (FMath::Abs(X) <= LoadRadius && FMath::Abs(Y) <= LoadRadius)
+				{
+					WantedCells.Add(Center + FIntPoint(X, Y));
+				}
+			}
+		}
+	}
+
+	// Release cells no player is near any more
+	for (auto It = Cells.CreateIterator(); It; ++It)
+	{
+		if (!KeptCells.Contains(It.Key()))
+		{
+			ReleaseCell(It.Value());
+			It.RemoveCurrent();
+		}
+	}
+
+	TArray<FIntPoint> MissingCells;
+	for (const FIntPoint& Cell : WantedCells)
+	{
+		if (!Cells.Contains(Cell))
+		{
+			MissingCells.Add(Cell);
+		}
+	}
+
+	// Nearest first, so the cell under a player is never waiting behind one at the edge
+	auto DistanceToPlayers = [this, &ViewLocations](const FIntPoint& Cell)
+	{
+		const FVector2D CellCenter = FVector2D(Cell) * CellSize;
+		double Nearest = TNumericLimits<double>::Max();
+		for (const FVector& ViewLocation : ViewLocations)
+		{
+			Nearest = FMath::Min(Nearest, FVector2D::DistSquared(CellCenter, FVector2D(ViewLocation)));
+		}
+		return Nearest;
+	};
+	MissingCells.Sort([&DistanceToPlayers](const FIntPoint& A, const FIntPoint& B) { return DistanceToPlayers(A) < DistanceToPlayers(B); });
+
+	for (int32 Index = 0; Index < FMath::Min(MissingCells.Num(), MaxCellLoadsPerUpdate); ++Index)
+	{
+		LoadCell(MissingCells[Index]);
+	}
+}
+
+void AIslandStreamer::LoadCell(const FIntPoint& Cell)
+{
+	UWorld* World = GetWorld();
+	if (!World) { return; }
+
+	UClass* Class = ConstructorClass ? ConstructorClass.Get() : AIslandConstructor::StaticClass();
+	const FTransform CellTransform(FVector(Cell.X * CellSize, Cell.Y * CellSize, 0.0f));
+	const FRandomStream CellSeed = MakeCellSeed(Cell);
+
+	// Deferred so the seed is in place before BeginPlay starts the (async) build
+	FIslandStreamCell& StreamCell = Cells.Add(Cell);
+	StreamCell.Constructor = World->SpawnActorDeferred<AIslandConstructor>(Class, CellTransform, this);
+	if (!StreamCell.Constructor)
+	{
+		UE_LOG(LogTemp, Error, TEXT("Failed to spawn the island constructor for cell %s"), *Cell.ToString());
+		return;
+	}
+	StreamCell.Constructor->SetSeed(CellSeed);
+	StreamCell.Constructor->FinishSpawning(CellTransform);
+
+	if (SpawnerClass)
+	{
+		StreamCell.Spawner = World->SpawnActorDeferred<ASpawner>(SpawnerClass, CellTransform, this);
+		if (StreamCell.Spawner)
+		{
+			// The spawner waits for the cell's surface, no navmesh needed
+			StreamCell.Spawner->ConfigureForIsland(StreamCell.Constructor, CellSeed);
+			StreamCell.Spawner->FinishSpawning(CellTransform);
+		}
+	}
+}
+
+void AIslandStreamer::ReleaseCell(FIslandStreamCell& StreamCell)
+{
+	if (IsValid(StreamCell.Spawner))
+	{
+		StreamCell.Spawner->ReleaseSpawnedContent();
+		StreamCell.Spawner->Destroy();
+	}
+
+	// Destroying the constructor cancels its build in flight and frees the mesh
+	if (IsValid(StreamCell.Constructor))
+	{
+		StreamCell.Constructor->Destroy();
+	}
+
+	StreamCell.Spawner = nullptr;
+	StreamCell.Constructor = nullptr;
+}
@@ -0,0 +1,89 @@
+// The source code, authored by Zoxemik in 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+#include "IslandStreamer.generated.h"
+
+class AIslandConstructor;
+class ASpawner;
+
+// What one streamed cell keeps alive
+USTRUCT()
+struct FIslandStreamCell
+{
+	GENERATED_USTRUCT_BODY()
+
+	UPROPERTY()
+	TObjectPtr<AIslandConstructor> Constructor;
+
+	UPROPERTY()
+	TObjectPtr<ASpawner> Spawner;
+};
+
+// Endless archipelago: splits the world into square cells and keeps an island constructor, and optionally a spawner,
+// alive in the cells around every player. Each cell's seed is the world seed hashed with the cell coordinates, so a
+// cell always comes back the same, and memory stays bounded however far the players travel
+UCLASS()
+class AIslandStreamer : public AActor
+{
+	GENERATED_BODY()
+
+public:
+	AIslandStreamer();
+
+	UFUNCTION(BlueprintPure, Category = "Island Generator")
+	int32 GetNumLoadedCells() const { return Cells.Num(); }
+
+	// Coordinates of the cell a world location falls into
+	UFUNCTION(BlueprintPure, Category = "Island Generator")
+	FIntPoint GetCellAt(const FVector& Location) const;
+
+protected:
+	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Streaming", meta = (ToolTip = "Constructor Blueprint spawned in every cell, with the island parameters and materials to use"))
+	TSubclassOf<AIslandConstructor> ConstructorClass;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Streaming", meta = (ToolTip = "Optional spawner Blueprint spawned in every cell, placing on that cell's island surface"))
+	TSubclassOf<ASpawner> SpawnerClass;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Streaming", meta = (ClampMin = "1000", ToolTip = "Width of one cell, about MaxSpawnDistance + 10000 of the constructor so neighbouring islands never overlap"))
+	float CellSize;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Streaming", meta = (ClampMin = "0", ToolTip = "Cells within this many cells of a player are generated"))
+	int32 LoadRadius;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Streaming", meta = (ClampMin = "0", ToolTip = "Cells further than this many cells from every player are released. Never below LoadRadius, keep it above to avoid thrashing at cell borders"))
+	int32 UnloadRadius;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Streaming", meta = (ClampMin = "1", ToolTip = "New cells started per update, nearest first, keeps the cost of any one frame constant"))
+	int32 MaxCellLoadsPerUpdate;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Streaming", meta = (ClampMin = "0.05"))
+	float UpdateInterval;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Default")
+	FRandomStream Seed;
+
+private:
+	UFUNCTION()
+	void UpdateCells();
+
+	void LoadCell(const FIntPoint& Cell);
+
+	void ReleaseCell(FIslandStreamCell& StreamCell);
+
+	FRandomStream MakeCellSeed(const FIntPoint& Cell) const;
+
+	UPROPERTY()
+	TMap<FIntPoint, FIslandStreamCell> Cells;
+
+	FTimerHandle UpdateHandle;
+};
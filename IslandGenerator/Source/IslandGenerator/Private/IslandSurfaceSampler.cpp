@@ -0,0 +1,96 @@
+// The source code, authored by Zoxemik in 2025
+
+#include "IslandSurfaceSampler.h"
+#include "Algo/BinarySearch.h"
+
+using namespace UE::Geometry;
+
+FIslandSurfaceSampler::FIslandSurfaceSampler(const FDynamicMesh3& Mesh)
+{
+	Corners.Reserve(Mesh.TriangleCount() * 3);
+	NormalZ.Reserve(Mesh.TriangleCount());
+	Areas.Reserve(Mesh.TriangleCount());
+
+	for (int32 TriangleID : Mesh.TriangleIndicesItr())
+	{
+		FVector3d A, B, C;
+		Mesh.GetTriVertices(TriangleID, A, B, C);
+
+		// Undersides and vertical walls can never hold anything. Same operand order as VectorUtil::Normal, the engine's
+		// left-handed winding faces (C - A) x (B - A)
+		const FVector3d Cross = (C - A).Cross(B - A);
+		const double DoubleArea = Cross.Length();
+		if (DoubleArea <= UE_DOUBLE_KINDA_SMALL_NUMBER || Cross.Z <= 0.0)
+		{
+			continue;
+		}
+
+		Corners.Add(FVector3f(A));
+		Corners.Add(FVector3f(B));
+		Corners.Add(FVector3f(C));
+		NormalZ.Add((float)(Cross.Z / DoubleArea));
+		Areas.Add((float)(DoubleArea * 0.5));
+	}
+
+	Corners.Shrink();
+	NormalZ.Shrink();
+	Areas.Shrink();
+}
+
+void FIslandSurfaceSampler::Select(const FSpawnSurfaceFilter& Filter, const FVector2D& Center, float Radius, FSelection& OutSelection) const
+{
+	OutSelection.Triangles.Reset();
+	OutSelection.CumulativeArea.Reset();
+
+	const float MinNormalZ = FMath::Cos(FMath::DegreesToRadians(FMath::Clamp(Filter.MaxSlopeAngle, 0.0f, 90.0f)));
+	const FVector2f Center2f(Center);
+	const float RadiusSquared = Radius * Radius;
+
+	float TotalArea = 0.0f;
+	for (int32 Index = 0; Index < Areas.Num(); ++Index)
+	{
+		if (NormalZ[Index] < MinNormalZ)
+		{
+			continue;
+		}
+
+		const FVector3f Centroid = (Corners[Index * 3] + Corners[Index * 3 + 1] + Corners[Index * 3 + 2]) / 3.0f;
+		if (Centroid.Z < Filter.MinHeight || Centroid.Z > Filter.MaxHeight)
+		{
+			continue;
+		}
+
+		if (Radius > 0.0f && FVector2f::DistSquared(FVector2f(Centroid.X, Centroid.Y), Center2f) > RadiusSquared)
+		{
+			continue;
+		}
+
+		TotalArea += Areas[Index];
+		OutSelection.Triangles.Add(Index);
+		OutSelection.CumulativeArea.Add(TotalArea);
+	}
+}
+
+bool FIslandSurfaceSampler::SamplePoint(const FSelection& Selection, FRandomStream& Stream, FVector& OutPoint) const
+{
+	if (Selection.IsEmpty())
+	{
+		return false;
+	}
+
+	// Pick a triangle by area, then a uniform point inside it
+	const float Target = Stream.FRand() * Selection.CumulativeArea.Last();
+	const int32 Index = Selection.Triangles[FMath::Min(Algo::LowerBound(Selection.CumulativeArea, Target), Selection.Triangles.Num() - 1)];
+
+	float U = Stream.FRand();
+	float V = Stream.FRand();
+	if (U + V > 1.0f)
+	{
+		U = 1.0f - U;
+		V = 1.0f - V;
+	}
+
+	const FVector3f& A = Corners[Index * 3];
+	OutPoint = FVector(A + (Corners[Index * 3 + 1] - A) * U + (Corners[Index * 3 + 2] - A) * V);
+	return true;
+}
@@ -0,0 +1,44 @@
+// The source code, authored by Zoxemik in 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "DynamicMesh/DynamicMesh3.h"
+#include "SpawnPlacement.h"
+
+// Upward facing triangles of a finished island mesh with their areas, for placing objects straight on the surface.
+// Immutable once built, so one instance can be shared with any number of threads
+class FIslandSurfaceSampler
+{
+public:
+	FIslandSurfaceSampler() = default;
+	explicit FIslandSurfaceSampler(const UE::Geometry::FDynamicMesh3& Mesh);
+
+	// Triangles that pass a filter, with a running area total to pick them by area
+	struct FSelection
+	{
+		TArray<int32> Triangles;
+		TArray<float> CumulativeArea;
+
+		bool IsEmpty() const { return Triangles.Num() == 0; }
+	};
+
+	// Collects the triangles within the filter's slope and height band. A positive Radius also limits them to that
+	// distance of Center on the XY plane, in constructor space
+	void Select(const FSpawnSurfaceFilter& Filter, const FVector2D& Center, float Radius, FSelection& OutSelection) const;
+
+	// Point uniformly distributed by area over the selection, in constructor space. Returns false if it is empty
+	bool SamplePoint(const FSelection& Selection, FRandomStream& Stream, FVector& OutPoint) const;
+
+	bool IsEmpty() const { return Areas.Num() == 0; }
+
+	int32 NumTriangles() const { return Areas.Num(); }
+
+private:
+	// Three corners per triangle
+	TArray<FVector3f> Corners;
+
+	TArray<float> NormalZ;
+
+	TArray<float> Areas;
+};
@@ -0,0 +1,479 @@
+// The source code, authored by Zoxemik in 2025
+
+#include "IslandTerrainGrid.h"
+#include "IslandMeshBuilder.h"
+#include "IslandLayoutResolver.h"
+#include "Algo/BinarySearch.h"
+#include "Async/ParallelFor.h"
+
+using namespace UE::Geometry;
+
+namespace IslandTerrainGrid
+{
+	// Batches below this are cheaper on the calling thread than handed to the task graph
+	static constexpr int32 MinParallelBatch = 4096;
+
+	// Cells past an island's shore radius it still claims, for ground the smoothing or the blend pushed outwards
+	static constexpr int32 IslandMarginCells = 4;
+}
+
+FIslandTerrainGrid::FIslandTerrainGrid(const FDynamicMesh3& Mesh, const TArray<FIslandShape>& Islands, int32 Resolution, const FIslandBiomeRules& BiomeRules)
+{
+	if (Mesh.TriangleCount() == 0 || Resolution <= 0)
+	{
+		return;
+	}
+
+	const FAxisAlignedBox3d Bounds = Mesh.GetBounds();
+	CellSize = (float)FMath::Max(FMath::Max(Bounds.Width(), Bounds.Height()) / Resolution, 1.0);
+	Origin = FVector2D(Bounds.Min.X, Bounds.Min.Y);
+	Size = FIntPoint(FMath::Max(FMath::CeilToInt32(Bounds.Width() / CellSize), 1), FMath::Max(FMath::CeilToInt32(Bounds.Height() / CellSize), 1));
+
+	Cells.SetNum(Size.X * Size.Y);
+
+	// Every upward facing triangle writes the cells whose centers it covers, the highest surface wins
+	for (int32 TriangleID : Mesh.TriangleIndicesItr())
+	{
+		FVector3d A, B, C;
+		Mesh.GetTriVertices(TriangleID, A, B, C);
+
+		// (C - A) x (B - A), the engine's left-handed winding, so up facing triangles have a positive Z
+		const FVector3d Cross = (C - A).Cross(B - A);
+		const double DoubleArea = Cross.Length();
+		if (DoubleArea <= UE_DOUBLE_KINDA_SMALL_NUMBER || Cross.Z <= 0.0)
+		{
+			continue;
+		}
+
+		const FVector3d Normal = Cross / DoubleArea;
+		const int8 NormalX = (int8)FMath::RoundToInt32(FMath::Clamp(Normal.X, -1.0, 1.0) * 127.0);
+		const int8 NormalY = (int8)FMath::RoundToInt32(FMath::Clamp(Normal.Y, -1.0, 1.0) * 127.0);
+
+		const int32 MinX = FMath::Max(FMath::FloorToInt32((FMath::Min3(A.X, B.X, C.X) - Origin.X) / CellSize - 0.5), 0);
+		const int32 MaxX = FMath::Min(FMath::CeilToInt32((FMath::Max3(A.X, B.X, C.X) - Origin.X) / CellSize - 0.5), Size.X - 1);
+		const int32 MinY = FMath::Max(FMath::FloorToInt32((FMath::Min3(A.Y, B.Y, C.Y) - Origin.Y) / CellSize - 0.5), 0);
+		const int32 MaxY = FMath::Min(FMath::CeilToInt32((FMath::Max3(A.Y, B.Y, C.Y) - Origin.Y) / CellSize - 0.5), Size.Y - 1);
+
+		// Barycentric weights of A, B and C on the XY projection. -Cross.Z is twice the signed area of (A, B, C)
+		// counter-clockwise, the orientation the sub-triangle areas below are measured in
+		const double InvArea = -1.0 / Cross.Z;
+		for (int32 Y = MinY; Y <= MaxY; ++Y)
+		{
+			for (int32 X = MinX; X <= MaxX; ++X)
+			{
+				const double PX = Origin.X + (X + 0.5) * CellSize;
+				const double PY = Origin.Y + (Y + 0.5) * CellSize;
+
+				const double U = ((B.X - PX) * (C.Y - PY) - (C.X - PX) * (B.Y - PY)) * InvArea;
+				const double V = ((C.X - PX) * (A.Y - PY) - (A.X - PX) * (C.Y - PY)) * InvArea;
+				const double W = 1.0 - U - V;
+				if (U < -UE_DOUBLE_KINDA_SMALL_NUMBER || V < -UE_DOUBLE_KINDA_SMALL_NUMBER || W < -UE_DOUBLE_KINDA_SMALL_NUMBER)
+				{
+					continue;
+				}
+
+				// Any island index marks the cell as covered, the real one is resolved below
+				FCell& Cell = Cells[X + Y * Size.X];
+				const float Height = (float)(A.Z * U + B.Z * V + C.Z * W);
+				if (Cell.IslandIndex == INDEX_NONE || Height > Cell.Height)
+				{
+					Cell.Height = Height;
+					Cell.NormalX = NormalX;
+					Cell.NormalY = NormalY;
+					Cell.IslandIndex = 0;
+				}
+			}
+		}
+	}
+
+	// Island of every land cell, the one whose shore is nearest like FindNearestIsland. Each island only visits the
+	// cells around its own footprint, so the cost follows the land area rather than cells times islands
+	TArray<double> ShoreRadii;
+	for (const FIslandShape& Island : Islands)
+	{
+		ShoreRadii.Add(FIslandLayoutResolver::GetShoreRadius(Island));
+	}
+
+	TArray<double> NearestDistance;
+	NearestDistance.Init(TNumericLimits<double>::Max(), Cells.Num());
+
+	auto ClaimCell = [this, &Islands, &ShoreRadii, &NearestDistance](int32 X, int32 Y, int32 IslandIndex)
+	{
+		const int32 CellIndex = X + Y * Size.X;
+		const FVector2D Center = Origin + FVector2D(X + 0.5, Y + 0.5) * CellSize;
+		const double Distance = FVector2D::Distance(Center, FVector2D(Islands[IslandIndex].Center)) - ShoreRadii[IslandIndex];
+		if (Distance < NearestDistance[CellIndex])
+		{
+			NearestDistance[CellIndex] = Distance;
+			Cells[CellIndex].IslandIndex = IslandIndex;
+		}
+	};
+
+	for (int32 IslandIndex = 0; IslandIndex < Islands.Num(); ++IslandIndex)
+	{
+		const FVector2D Center(Islands[IslandIndex].Center);
+		const double Reach = ShoreRadii[IslandIndex] + IslandTerrainGrid::IslandMarginCells * CellSize;
+		const int32 MinX = FMath::Max(FMath::FloorToInt32((Center.X - Reach - Origin.X) / CellSize), 0);
+		const int32 MaxX = FMath::Min(FMath::FloorToInt32((Center.X + Reach - Origin.X) / CellSize), Size.X - 1);
+		const int32 MinY = FMath::Max(FMath::FloorToInt32((Center.Y - Reach - Origin.Y) / CellSize), 0);
+		const int32 MaxY = FMath::Min(FMath::FloorToInt32((Center.Y + Reach - Origin.Y) / CellSize), Size.Y - 1);
+		for (int32 Y = MinY; Y <= MaxY; ++Y)
+		{
+			for (int32 X = MinX; X <= MaxX; ++X)
+			{
+				if (Cells[X + Y * Size.X].IslandIndex != INDEX_NONE)
+				{
+					ClaimCell(X, Y, IslandIndex);
+				}
+			}
+		}
+	}
+
+	// Land no footprint reached, rare enough to scan every island for
+	ParallelFor(Size.Y, [this, &Islands, &NearestDistance, &ClaimCell](int32 Y)
+	{
+		for (int32 X = 0; X < Size.X; ++X)
+		{
+			const int32 CellIndex = X + Y * Size.X;
+			if (Cells[CellIndex].IslandIndex == INDEX_NONE || NearestDistance[CellIndex] < TNumericLimits<double>::Max())
+			{
+				continue;
+			}
+
+			for (int32 IslandIndex = 0; IslandIndex < Islands.Num(); ++IslandIndex)
+			{
+				ClaimCell(X, Y, IslandIndex);
+			}
+		}
+	});
+
+	ClassifyBiomes(Islands, ShoreRadii, BiomeRules);
+}
+
+void FIslandTerrainGrid::ClassifyBiomes(const TArray<FIslandShape>& Islands, const TArray<double>& ShoreRadii, const FIslandBiomeRules& BiomeRules)
+{
+	// Distance of every land cell to the nearest water cell, in cells, by a two pass chamfer transform. Outside the
+	// grid counts as water, the grid ends where the mesh does
+	const float Diagonal = UE_SQRT_2;
+	TArray<float> ShoreDistance;
+	ShoreDistance.SetNumUninitialized(Cells.Num());
+	for (int32 CellIndex = 0; CellIndex < Cells.Num(); ++CellIndex)
+	{
+		ShoreDistance[CellIndex] = Cells[CellIndex].IslandIndex == INDEX_NONE ? 0.0f : TNumericLimits<float>::Max();
+	}
+
+	auto Distance = [this, &ShoreDistance](int32 X, int32 Y)
+	{
+		return (X < 0 || Y < 0 || X >= Size.X || Y >= Size.Y) ? 0.0f : ShoreDistance[X + Y * Size.X];
+	};
+
+	for (int32 Y = 0; Y < Size.Y; ++Y)
+	{
+		for (int32 X = 0; X < Size.X; ++X)
+		{
+			float& Current = ShoreDistance[X + Y * Size.X];
+			Current = FMath::Min3(Current, Distance(X - 1, Y) + 1.0f, Distance(X, Y - 1) + 1.0f);
+			Current = FMath::Min3(Current, Distance(X - 1, Y - 1) + Diagonal, Distance(X + 1, Y - 1) + Diagonal);
+		}
+	}
+	for (int32 Y = Size.Y - 1; Y >= 0; --Y)
+	{
+		for (int32 X = Size.X - 1; X >= 0; --X)
+		{
+			float& Current = ShoreDistance[X + Y * Size.X];
+			Current = FMath::Min3(Current, Distance(X + 1, Y) + 1.0f, Distance(X, Y + 1) + 1.0f);
+			Current = FMath::Min3(Current, Distance(X + 1, Y + 1) + Diagonal, Distance(X - 1, Y + 1) + Diagonal);
+		}
+	}
+
+	const float MinGentleNormalZ = FMath::Cos(FMath::DegreesToRadians(FMath::Clamp(BiomeRules.CliffSlopeAngle, 0.0f, 90.0f)));
+	const float ShoreWidthCells = BiomeRules.ShoreWidth / CellSize;
+
+	// Cliff wins over everything, then Shore, Interior, Upland, and Lowland is whatever is left
+	Biomes.SetNumZeroed(Cells.Num());
+	ParallelFor(Size.Y, [&](int32 Y)
+	{
+		for (int32 X = 0; X < Size.X; ++X)
+		{
+			const int32 CellIndex = X + Y * Size.X;
+			const FCell& Cell = Cells[CellIndex];
+			if (Cell.IslandIndex == INDEX_NONE)
+			{
+				continue;
+			}
+
+			EIslandBiome Biome = EIslandBiome::Lowland;
+			if (UnpackNormal(Cell).Z < MinGentleNormalZ)
+			{
+				Biome = EIslandBiome::Cliff;
+			}
+			else if (ShoreDistance[CellIndex] <= ShoreWidthCells)
+			{
+				Biome = EIslandBiome::Shore;
+			}
+			else if (Islands.IsValidIndex(Cell.IslandIndex)
+				&& FVector2D::Distance(Origin + FVector2D(X + 0.5, Y + 0.5) * CellSize, FVector2D(Islands[Cell.IslandIndex].Center)) <= BiomeRules.InteriorRadius * ShoreRadii[Cell.IslandIndex])
+			{
+				Biome = EIslandBiome::Interior;
+			}
+			else if (Cell.Height >= BiomeRules.UplandHeight)
+			{
+				Biome = EIslandBiome::Upland;
+			}
+
+			Biomes[CellIndex] = (uint8)Biome;
+		}
+	});
+}
+
+FVector3f FIslandTerrainGrid::UnpackNormal(const FCell& Cell)
+{
+	const float X = Cell.NormalX / 127.0f;
+	const float Y = Cell.NormalY / 127.0f;
+	return FVector3f(X, Y, FMath::Sqrt(FMath::Max(1.0f - X * X - Y * Y, 0.0f)));
+}
+
+int32 FIslandTerrainGrid::GetLandCell(const FVector2D& Location) const
+{
+	const int32 CellX = FMath::FloorToInt32((Location.X - Origin.X) / CellSize);
+	const int32 CellY = FMath::FloorToInt32((Location.Y - Origin.Y) / CellSize);
+	if (CellX < 0 || CellY < 0 || CellX >= Size.X || CellY >= Size.Y)
+	{
+		return INDEX_NONE;
+	}
+
+	const int32 CellIndex = CellX + CellY * Size.X;
+	return Cells[CellIndex].IslandIndex == INDEX_NONE ? INDEX_NONE : CellIndex;
+}
+
+bool FIslandTerrainGrid::SampleLocal(const FVector2D& Location, float& OutHeight, FVector3f& OutNormal, int32& OutCellIndex) const
+{
+	// The cell under the location decides land or water
+	OutCellIndex = GetLandCell(Location);
+	if (OutCellIndex == INDEX_NONE)
+	{
+		return false;
+	}
+
+	const double GridX = (Location.X - Origin.X) / CellSize;
+	const double GridY = (Location.Y - Origin.Y) / CellSize;
+
+	// Bilinear between the four surrounding cell centers, water neighbours are left out
+	const int32 X0 = FMath::FloorToInt32(GridX - 0.5);
+	const int32 Y0 = FMath::FloorToInt32(GridY - 0.5);
+	const float TX = (float)(GridX - 0.5 - X0);
+	const float TY = (float)(GridY - 0.5 - Y0);
+
+	float WeightSum = 0.0f;
+	float Height = 0.0f;
+	FVector3f Normal = FVector3f::ZeroVector;
+	for (int32 Corner = 0; Corner < 4; ++Corner)
+	{
+		const int32 X = X0 + (Corner & 1);
+		const int32 Y = Y0 + (Corner >> 1);
+		if (X < 0 || Y < 0 || X >= Size.X || Y >= Size.Y)
+		{
+			continue;
+		}
+
+		const FCell& Cell = Cells[X + Y * Size.X];
+		if (Cell.IslandIndex == INDEX_NONE)
+		{
+			continue;
+		}
+
+		const float Weight = ((Corner & 1) ? TX : 1.0f - TX) * ((Corner >> 1) ? TY : 1.0f - TY);
+		WeightSum += Weight;
+		Height += Cell.Height * Weight;
+		Normal += UnpackNormal(Cell) * Weight;
+	}
+
+	// Right on a land cell center next to water every other weight can be zero
+	if (WeightSum <= UE_KINDA_SMALL_NUMBER)
+	{
+		const FCell& Cell = Cells[OutCellIndex];
+		OutHeight = Cell.Height;
+		OutNormal = UnpackNormal(Cell);
+		return true;
+	}
+
+	OutHeight = Height / WeightSum;
+	OutNormal = Normal.GetSafeNormal(UE_SMALL_NUMBER, FVector3f::UpVector);
+	return true;
+}
+
+bool FIslandTerrainGrid::Sample(const FVector& Location, FIslandTerrainSample& OutSample) const
+{
+	OutSample = FIslandTerrainSample();
+
+	const FVector LocalLocation = LocalToWorld.InverseTransformPosition(Location);
+
+	float Height;
+	FVector3f Normal;
+	int32 CellIndex;
+	if (!SampleLocal(FVector2D(LocalLocation), Height, Normal, CellIndex))
+	{
+		return false;
+	}
+
+	OutSample.bIsLand = true;
+	OutSample.IslandIndex = Cells[CellIndex].IslandIndex;
+	OutSample.Biome = (EIslandBiome)Biomes[CellIndex];
+	OutSample.Height = (float)LocalToWorld.TransformPosition(FVector(LocalLocation.X, LocalLocation.Y, Height)).Z;
+	OutSample.Normal = LocalToWorld.TransformVectorNoScale(FVector(Normal));
+	OutSample.SlopeAngle = FMath::RadiansToDegrees(FMath::Acos(FMath::Clamp((float)OutSample.Normal.Z, -1.0f, 1.0f)));
+	return true;
+}
+
+void FIslandTerrainGrid::SampleBatch(TConstArrayView<FVector> Locations, TArrayView<FIslandTerrainSample> OutSamples) const
+{
+	check(Locations.Num() == OutSamples.Num());
+
+	ParallelFor(Locations.Num(), [this, &Locations, &OutSamples](int32 Index)
+	{
+		Sample(Locations[Index], OutSamples[Index]);
+	}, Locations.Num() < IslandTerrainGrid::MinParallelBatch ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+}
+
+bool FIslandTerrainGrid::GetHeight(const FVector& Location, float& OutHeight) const
+{
+	FIslandTerrainSample TerrainSample;
+	if (!Sample(Location, TerrainSample))
+	{
+		return false;
+	}
+
+	OutHeight = TerrainSample.Height;
+	return true;
+}
+
+bool FIslandTerrainGrid::GetNormal(const FVector& Location, FVector& OutNormal) const
+{
+	FIslandTerrainSample TerrainSample;
+	if (!Sample(Location, TerrainSample))
+	{
+		return false;
+	}
+
+	OutNormal = TerrainSample.Normal;
+	return true;
+}
+
+bool FIslandTerrainGrid::GetSlopeAngle(const FVector& Location, float& OutSlopeAngle) const
+{
+	FIslandTerrainSample TerrainSample;
+	if (!Sample(Location, TerrainSample))
+	{
+		return false;
+	}
+
+	OutSlopeAngle = TerrainSample.SlopeAngle;
+	return true;
+}
+
+bool FIslandTerrainGrid::IsLand(const FVector& Location) const
+{
+	return GetIslandIndex(Location) != INDEX_NONE;
+}
+
+int32 FIslandTerrainGrid::GetIslandIndex(const FVector& Location) const
+{
+	// Land or water only needs the cell under the location, no interpolation
+	const int32 CellIndex = GetLandCell(FVector2D(LocalToWorld.InverseTransformPosition(Location)));
+	return CellIndex == INDEX_NONE ? INDEX_NONE : Cells[CellIndex].IslandIndex;
+}
+
+bool FIslandTerrainGrid::GetBiome(const FVector& Location, EIslandBiome& OutBiome) const
+{
+	const int32 CellIndex = GetLandCell(FVector2D(LocalToWorld.InverseTransformPosition(Location)));
+	if (CellIndex == INDEX_NONE)
+	{
+		return false;
+	}
+
+	OutBiome = (EIslandBiome)Biomes[CellIndex];
+	return true;
+}
+
+void FIslandTerrainGrid::SelectCells(const TArray<FSpawnBiomeWeight>& BiomeWeights, const FSpawnSurfaceFilter& Filter, const FVector2D& Center, float Radius, FCellSelection& OutSelection) const
+{
+	OutSelection.Cells.Reset();
+	OutSelection.CumulativeWeight.Reset();
+
+	float Weights[(int32)EIslandBiome::MAX] = {};
+	for (const FSpawnBiomeWeight& BiomeWeight : BiomeWeights)
+	{
+		if (BiomeWeight.Biome < EIslandBiome::MAX)
+		{
+			Weights[(int32)BiomeWeight.Biome] += FMath::Max(BiomeWeight.Weight, 0.0f);
+		}
+	}
+
+	const float MinNormalZ = FMath::Cos(FMath::DegreesToRadians(FMath::Clamp(Filter.MaxSlopeAngle, 0.0f, 90.0f)));
+
+	// Only the cells in the square around the circle need a look
+	FIntPoint Min(0, 0);
+	FIntPoint Max(Size.X - 1, Size.Y - 1);
+	if (Radius > 0.0f)
+	{
+		Min.X = FMath::Max(FMath::FloorToInt32((Center.X - Radius - Origin.X) / CellSize), 0);
+		Min.Y = FMath::Max(FMath::FloorToInt32((Center.Y - Radius - Origin.Y) / CellSize), 0);
+		Max.X = FMath::Min(FMath::FloorToInt32((Center.X + Radius - Origin.X) / CellSize), Size.X - 1);
+		Max.Y = FMath::Min(FMath::FloorToInt32((Center.Y + Radius - Origin.Y) / CellSize), Size.Y - 1);
+	}
+
+	const double RadiusSquared = (double)Radius * Radius;
+	float TotalWeight = 0.0f;
+	for (int32 Y = Min.Y; Y <= Max.Y; ++Y)
+	{
+		for (int32 X = Min.X; X <= Max.X; ++X)
+		{
+			const int32 CellIndex = X + Y * Size.X;
+			const FCell& Cell = Cells[CellIndex];
+			if (Cell.IslandIndex == INDEX_NONE)
+			{
+				continue;
+			}
+
+			const float Weight = Weights[Biomes[CellIndex]];
+			if (Weight <= 0.0f || UnpackNormal(Cell).Z < MinNormalZ || Cell.Height < Filter.MinHeight || Cell.Height > Filter.MaxHeight)
+			{
+				continue;
+			}
+
+			if (Radius > 0.0f && FVector2D::DistSquared(Origin + FVector2D(X + 0.5, Y + 0.5) * CellSize, Center) > RadiusSquared)
+			{
+				continue;
+			}
+
+			TotalWeight += Weight;
+			OutSelection.Cells.Add(CellIndex);
+			OutSelection.CumulativeWeight.Add(TotalWeight);
+		}
+	}
+}
+
+bool FIslandTerrainGrid::SamplePoint(const FCellSelection& Selection, FRandomStream& Stream, FVector& OutPoint) const
+{
+	if (Selection.IsEmpty())
+	{
+		return false;
+	}
+
+	// Pick a cell by weight, then a uniform point inside it
+	const float Target = Stream.FRand() * Selection.CumulativeWeight.Last();
+	const int32 CellIndex = Selection.Cells[FMath::Min(Algo::LowerBound(Selection.CumulativeWeight, Target), Selection.Cells.Num() - 1)];
+
+	const FVector2D Location = Origin + FVector2D(CellIndex % Size.X + Stream.FRand(), CellIndex / Size.X + Stream.FRand()) * CellSize;
+
+	float Height;
+	FVector3f Normal;
+	int32 SampledCellIndex;
+	if (!SampleLocal(Location, Height, Normal, SampledCellIndex))
+	{
+		Height = Cells[CellIndex].Height;
+	}
+
+	OutPoint = FVector(Location.X, Location.Y, Height);
+	return true;
+}
@@ -0,0 +1,105 @@
+// The source code, authored by Zoxemik in 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "DynamicMesh/DynamicMesh3.h"
+#include "IslandTerrainSample.h"
+#include "SpawnPlacement.h"
+
+struct FIslandShape;
+
+// Top surface of a finished island on a regular XY grid: height, normal, island and biome per cell. Immutable once it is
+// published, so one instance can be queried from any number of threads at once
+class FIslandTerrainGrid
+{
+public:
+	FIslandTerrainGrid() = default;
+
+	// Rasterizes the upward facing triangles of the mesh, Resolution cells along the longer side of its bounds, then
+	// classifies every land cell by the rules
+	FIslandTerrainGrid(const UE::Geometry::FDynamicMesh3& Mesh, const TArray<FIslandShape>& Islands, int32 Resolution, const FIslandBiomeRules& BiomeRules);
+
+	// Land cells that pass a filter, with a running weight total to pick them by
+	struct FCellSelection
+	{
+		TArray<int32> Cells;
+		TArray<float> CumulativeWeight;
+
+		bool IsEmpty() const { return Cells.Num() == 0; }
+	};
+
+	// Constructor space to world, set once before the grid is shared
+	void SetLocalToWorld(const FTransform& InLocalToWorld) { LocalToWorld = InLocalToWorld; }
+
+	// Bilinear height and normal at the world XY of the location, Z is ignored. Returns whether it is over land
+	bool Sample(const FVector& Location, FIslandTerrainSample& OutSample) const;
+
+	// Same as Sample for every location, OutSamples must be as long as Locations
+	void SampleBatch(TConstArrayView<FVector> Locations, TArrayView<FIslandTerrainSample> OutSamples) const;
+
+	bool GetHeight(const FVector& Location, float& OutHeight) const;
+
+	bool GetNormal(const FVector& Location, FVector& OutNormal) const;
+
+	bool GetSlopeAngle(const FVector& Location, float& OutSlopeAngle) const;
+
+	bool IsLand(const FVector& Location) const;
+
+	// Index of the island the location is on, INDEX_NONE over water
+	int32 GetIslandIndex(const FVector& Location) const;
+
+	// Biome of the cell under the location, false over water
+	bool GetBiome(const FVector& Location, EIslandBiome& OutBiome) const;
+
+	// Collects the land cells whose biome has a positive weight and that lie within the filter's slope and height band,
+	// each weighted by its biome. A positive Radius also limits them to that distance of Center, in constructor space
+	void SelectCells(const TArray<FSpawnBiomeWeight>& BiomeWeights, const FSpawnSurfaceFilter& Filter, const FVector2D& Center, float Radius, FCellSelection& OutSelection) const;
+
+	// Point on the surface, uniformly distributed within a cell picked by weight, in constructor space. Returns false if
+	// the selection is empty
+	bool SamplePoint(const FCellSelection& Selection, FRandomStream& Stream, FVector& OutPoint) const;
+
+	bool IsEmpty() const { return Cells.Num() == 0; }
+
+	FIntPoint GetSize() const { return Size; }
+
+	float GetCellSize() const { return CellSize; }
+
+private:
+	// Normal X and Y quantized to a byte each, Z follows since every cell faces up
+	struct FCell
+	{
+		float Height = 0.0f;
+
+		int8 NormalX = 0;
+
+		int8 NormalY = 0;
+
+		int32 IslandIndex = INDEX_NONE;
+	};
+
+	// Same as Sample, in constructor space. OutCellIndex is the cell under the location
+	bool SampleLocal(const FVector2D& Location, float& OutHeight, FVector3f& OutNormal, int32& OutCellIndex) const;
+
+	// Index of the land cell under a constructor space location, INDEX_NONE over water
+	int32 GetLandCell(const FVector2D& Location) const;
+
+	void ClassifyBiomes(const TArray<FIslandShape>& Islands, const TArray<double>& ShoreRadii, const FIslandBiomeRules& BiomeRules);
+
+	static FVector3f UnpackNormal(const FCell& Cell);
+
+	TArray<FCell> Cells;
+
+	// EIslandBiome per cell, parallel to Cells and meaningless over water
+	TArray<uint8> Biomes;
+
+	FIntPoint Size = FIntPoint::ZeroValue;
+
+	// Corner of cell (0, 0), in constructor space
+	FVector2D Origin = FVector2D::ZeroVector;
+
+	float CellSize = 1.0f;
+
+	FTransform LocalToWorld;
+};
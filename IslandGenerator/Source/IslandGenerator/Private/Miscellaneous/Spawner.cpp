@@ -1,282 +1,984 @@
-// The source code, authored by Zoxemik in 2025
-
-#include "Spawner.h"
-#include "TimerManager.h"
-#include "NavigationSystem.h"
-#include "Engine/AssetManager.h"
-#include "Engine/StreamableManager.h"
-#include "Kismet/KismetMathLibrary.h"
-#include "Kismet/GameplayStatics.h"
-#include "Math/UnrealMathUtility.h"
-#include "Components/InstancedStaticMeshComponent.h"
-#include "IslandPluginInterface.h"
-
-ASpawner::ASpawner()
-{
-	PrimaryActorTick.bCanEverTick = false;
-
-	Seed.Initialize(0);
-
-	bAsyncComplete = false;
-	bAutoSpawn = true;
-	bActorSwitch = true;
-
-	Counter = 0;
-	IndexCounter = 0;
-	ClassRefIndex = 0;
-
-	Step = 200.0f;
-}
-
-void ASpawner::BeginPlay()
-{
-	Super::BeginPlay();
-	UGameInstance* GameInstance = UGameplayStatics::GetGameInstance(this);
-	if (GameInstance->GetClass()->ImplementsInterface(UIslandPluginInterface::StaticClass()))
-	{
-		// Retrieve the island seed from the game instance
-		Seed = IIslandPluginInterface::Execute_IslandSeed(GameInstance);
-	}
-
-	AsyncLoadClasses();
-}
-
-void ASpawner::AsyncLoadClasses()
-{
-	if (SpawnTypes.Num() == 0)
-	{
-		UE_LOG(LogTemp, Warning, TEXT("SpawnTypes is empty."));
-		bAsyncComplete = true;
-		return;
-	}
-
-	ClassRefIndex = 0;
-	bAsyncComplete = false;
-	AsyncClass();
-}
-
-void ASpawner::AsyncClass()
-{
-	FStreamableManager& Streamable = UAssetManager::GetStreamableManager();
-	Streamable.RequestAsyncLoad(SpawnTypes[ClassRefIndex].ClassRef.ToSoftObjectPath(), FStreamableDelegate::CreateUObject(this, &ASpawner::OnAsyncClassCompleted));
-}
-
-void ASpawner::OnAsyncClassCompleted()
-{
-	UE_LOG(LogTemp, Warning, TEXT("Async load completed for class index: %d"), ClassRefIndex);
-
-	ClassRefIndex++;
-
-	// If we've loaded all classes, mark it complete and optionally auto-spawn
-	if (ClassRefIndex >= SpawnTypes.Num())
-	{
-		bAsyncComplete = true;
-
-		if (bAutoSpawn)
-		{
-			SpawnRandom();
-		}
-	}
-	else
-	{
-		AsyncClass();
-	}
-}
-
-void ASpawner::SpawnRandom()
-{
-
-	GetWorld()->GetTimerManager().SetTimerForNextTick([this]()
-	{
-			Counter = 0;
-			IndexCounter = 0;
-	});
-
-	FTimerDelegate NavCheckDelegate;
-	NavCheckDelegate.BindUFunction(this, FName("ReadyToSpawn"));
-
-	// Set a recurring timer (0.5s interval) to check if we're ready to spawn
-	// The initial delay is -0.5s, effectively meaning start almost immediately
-	GetWorld()->GetTimerManager().SetTimer(NavCheckHandle, NavCheckDelegate, 0.5f, true, -0.5f);
-}
-
-void ASpawner::ReadyToSpawn()
-{
-	UNavigationSystemV1* NavSystem = UNavigationSystemV1::GetCurrent(GetWorld());
-	if (!NavSystem)
-	{
-		UE_LOG(LogTemp, Error, TEXT("NavSystem invalid!"));
-		return;
-	}
-
-	// Check if the navigation system is not being built or locked
-	if (bAsyncComplete && NavSystem && !NavSystem->IsNavigationBeingBuiltOrLocked(this))
-	{
-		GetWorld()->GetTimerManager().PauseTimer(NavCheckHandle);
-
-		if (bActorSwitch)
-		{
-			if (SpawnTypes.IsValidIndex(IndexCounter))
-			{
-				TSubclassOf<AActor> SpawnObject = SpawnTypes[IndexCounter].ClassRef.LoadSynchronous();
-				GenerateAssets(SpawnObject, SpawnTypes[IndexCounter]);
-				IndexCounter++;
-				if (IndexCounter >= SpawnTypes.Num())
-				{
-					IndexCounter = 0;
-					bActorSwitch = false;
-				}
-				else
-				{
-					GetWorld()->GetTimerManager().UnPauseTimer(NavCheckHandle);
-				}
-			}
-			else
-			{
-				UE_LOG(LogTemp, Error, TEXT("IndexCounter is out of bounds for SpawnTypes."));
-			}
-		}
-		else
-		{
-			if (SpawnInstances.IsValidIndex(IndexCounter))
-			{
-				UInstancedStaticMeshComponent* InstancedMeshComp = NewObject<UInstancedStaticMeshComponent>(this);
-				if (InstancedMeshComp)
-				{
-					InstancedMeshComp->RegisterComponent();
-					InstancedMeshComp->AttachToComponent(RootComponent, FAttachmentTransformRules::KeepRelativeTransform);
-					InstancedMeshComp->SetStaticMesh(SpawnInstances[IndexCounter].ClassMeshRef);
-					GenerateInstances(InstancedMeshComp, SpawnInstances[IndexCounter].BiomeScale, SpawnInstances[IndexCounter].BiomeCount, SpawnInstances[IndexCounter].SpawnPerBiome);
-				}
-				IndexCounter++;
-				if (IndexCounter >= SpawnTypes.Num())
-				{
-					FinishSpawning();
-				}
-				else
-				{
-					GetWorld()->GetTimerManager().UnPauseTimer(NavCheckHandle);
-				}
-			}
-			else
-			{
-				UE_LOG(LogTemp, Error, TEXT("IndexCounter is out of bounds for SpawnInstances."));
-			}
-		}
-	}
-}
-
-void ASpawner::GenerateAssets(TSubclassOf<AActor> Class, FSpawnData SpawnParams)
-{
-	UNavigationSystemV1* NavSystem = UNavigationSystemV1::GetCurrent(GetWorld());
-	if (!NavSystem)
-	{
-		UE_LOG(LogTemp, Error, TEXT("NavSystem invalid!"));
-		return;
-	}
-
-	for (int32 i = 0; i < SpawnParams.BiomeCount; i++)
-	{
-		FVector RandomLocation = FVector(0);
-
-		FNavLocation NavLocationFirst;
-
-		bool bFoundFirst = NavSystem->GetRandomPointInNavigableRadius(FVector(0.0f, 0.0f, 0.0f), 10000.f, NavLocationFirst, NavData);
-		if (bFoundFirst)
-		{
-			RandomLocation = NavLocationFirst.Location;
-		}
-
-		int32 MaxNumberOfLocations = UKismetMathLibrary::RandomIntegerInRangeFromStream(Seed , 0, SpawnParams.SpawnPerBiome);
-
-		for (int32 j = 0; j < MaxNumberOfLocations; j++)
-		{
-			FVector RandomSpawnLocation = FVector(0);
-
-			FNavLocation NavLocationSecond;
-
-			bool bFoundSecond = NavSystem->GetRandomPointInNavigableRadius(RandomLocation, SpawnParams.BiomeScale, NavLocationSecond, NavData);
-			if (bFoundSecond)
-			{
-				RandomSpawnLocation = NavLocationSecond.Location;
-			}
-			else
-			{
-				UE_LOG(LogTemp, Warning, TEXT("Navigation Mesh is not working"))
-			}
-
-			FRotator RandomRotation = FRotator(0.0f, 0.0f, UKismetMathLibrary::RandomFloatInRange(0.0f, SpawnParams.RandomRotationRange));
-			FVector RandomScale = FVector(UKismetMathLibrary::RandomFloatInRange(1.0f, SpawnParams.ScaleRange + 1.0f));
-			FTransform FinalSpawnLocation = UKismetMathLibrary::MakeTransform(SteppedPosition(RandomSpawnLocation), RandomRotation, RandomScale);
-
-			UWorld* World = GetWorld();
-			if (!World) { return; }
-
-			World->SpawnActor<AActor>(Class, FinalSpawnLocation);
-		}
-	}
-}
-
-void ASpawner::GenerateInstances(UInstancedStaticMeshComponent* MeshClass, float Radius, int32 BiomeCount, int32 MaxSpawn)
-{
-	UNavigationSystemV1* NavSystem = UNavigationSystemV1::GetCurrent(GetWorld());
-	if (!NavSystem)
-	{
-		UE_LOG(LogTemp, Error, TEXT("NavSystem invalid!"));
-		return;
-	}
-
-	for (int32 i = 0; i < BiomeCount; i++)
-	{
-		FVector RandomLocation = FVector(0);
-
-		FNavLocation NavLocationFirst;
-
-		bool bFoundFirst = NavSystem->GetRandomPointInNavigableRadius(FVector(0.0f, 0.0f, 0.0f), 10000.f, NavLocationFirst, NavData);
-		if (bFoundFirst)
-		{
-			RandomLocation = NavLocationFirst.Location;
-		}
-
-		int32 MaxNumberOfLocations = UKismetMathLibrary::RandomIntegerInRangeFromStream(Seed, 0, MaxSpawn);
-
-		for (int32 j = 0; j < MaxNumberOfLocations; j++)
-		{
-			FVector RandomSpawnLocation = FVector(0);
-
-			FNavLocation NavLocationSecond;
-
-			bool bFoundSecond = NavSystem->GetRandomPointInNavigableRadius(RandomLocation, Radius, NavLocationSecond, NavData);
-			if (bFoundSecond)
-			{
-				RandomSpawnLocation = NavLocationSecond.Location;
-			}
-			else
-			{
-				UE_LOG(LogTemp, Warning, TEXT("Navigation Mesh is not working"))
-			}
-
-			FRotator RandomRotation = FRotator(0.0f, 0.0f, UKismetMathLibrary::RandomFloatInRange(0.0f, 360.f));
-			FVector RandomScale = FVector(UKismetMathLibrary::Lerp(0.8f, 1.5f, UKismetMathLibrary::SafeDivide(UKismetMathLibrary::Subtract_VectorVector(RandomLocation, RandomSpawnLocation).Length(), Radius)));
-			FTransform FinalSpawnLocation = UKismetMathLibrary::MakeTransform(SteppedPosition(RandomSpawnLocation), RandomRotation, RandomScale);
-
-			MeshClass->AddInstance(FinalSpawnLocation, true);
-
-			Counter++;
-		}
-	}
-}
-
-void ASpawner::FinishSpawning()
-{
-	UE_LOG(LogTemp, Warning, TEXT("Spawn finished"))
-}
-
-FVector ASpawner::SteppedPosition(FVector Param)
-{
-	// Snap the X and Y coordinates to multiples of Step
-	float RoundedX = FMath::RoundToFloat(Param.X / Step) * Step;
-	float RoundedY = FMath::RoundToFloat(Param.Y / Step) * Step;
-
-	return FVector(RoundedX, RoundedY, 0.0f);
+// The source code, authored by Zoxemik in 2025
+
+#include "Spawner.h"
+#include "TimerManager.h"
+#include "NavigationSystem.h"
+#include "Engine/AssetManager.h"
+#include "Engine/StreamableManager.h"
+#include "Kismet/KismetMathLibrary.h"
+#include "Kismet/GameplayStatics.h"
+#include "GameFramework/GameModeBase.h"
+#include "Math/UnrealMathUtility.h"
+#include "Components/InstancedStaticMeshComponent.h"
+#include "Components/HierarchicalInstancedStaticMeshComponent.h"
+#include "IslandPluginInterface.h"
+#include "IslandConstructor.h"
+#include "IslandGenerationSubsystem.h"
+#include "IslandSurfaceSampler.h"
+#include "IslandTerrainGrid.h"
+#include "SpawnSpacingGrid.h"
+#include "EngineUtils.h"
+#include "Async/ParallelFor.h"
+
+namespace SpawnerPlacement
+{
+	// What placement reads from an FSpawnData or FSpawnInstance, so both go through the same code
+	struct FEntry
+	{
+		bool bInstances = false;
+		int32 EntryIndex = 0;
+		float BiomeScale = 0.0f;
+		int32 BiomeCount = 0;
+		int32 SpawnPerBiome = 0;
+		float RandomRotationRange = 0.0f;
+		float ScaleRange = 0.0f;
+		float MinSpacing = 0.0f;
+		float ExclusionRadius = 0.0f;
+		FSpawnSurfaceFilter SurfaceFilter;
+		TArray<FSpawnBiomeWeight> BiomeWeights;
+	};
+
+	static FEntry MakeEntry(const TArray<FSpawnData>& SpawnTypes, const TArray<FSpawnInstance>& SpawnInstances, bool bInstances, int32 EntryIndex)
+	{
+		FEntry Entry;
+		Entry.bInstances = bInstances;
+		Entry.EntryIndex = EntryIndex;
+		if (bInstances && SpawnInstances.IsValidIndex(EntryIndex))
+		{
+			const FSpawnInstance& SpawnInstance = SpawnInstances[EntryIndex];
+			Entry.BiomeScale = SpawnInstance.BiomeScale;
+			Entry.BiomeCount = SpawnInstance.BiomeCount;
+			Entry.SpawnPerBiome = SpawnInstance.SpawnPerBiome;
+			Entry.MinSpacing = SpawnInstance.MinSpacing;
+			Entry.ExclusionRadius = SpawnInstance.ExclusionRadius;
+			Entry.SurfaceFilter = SpawnInstance.SurfaceFilter;
+			Entry.BiomeWeights = SpawnInstance.BiomeWeights;
+		}
+		else if (!bInstances && SpawnTypes.IsValidIndex(EntryIndex))
+		{
+			const FSpawnData& SpawnType = SpawnTypes[EntryIndex];
+			Entry.BiomeScale = SpawnType.BiomeScale;
+			Entry.BiomeCount = SpawnType.BiomeCount;
+			Entry.SpawnPerBiome = SpawnType.SpawnPerBiome;
+			Entry.RandomRotationRange = SpawnType.RandomRotationRange;
+			Entry.ScaleRange = SpawnType.ScaleRange;
+			Entry.MinSpacing = SpawnType.MinSpacing;
+			Entry.ExclusionRadius = SpawnType.ExclusionRadius;
+			Entry.SurfaceFilter = SpawnType.SurfaceFilter;
+			Entry.BiomeWeights = SpawnType.BiomeWeights;
+		}
+		return Entry;
+	}
+
+	// Independent stream per seed, entry and biome, so neither evaluation order nor thread count can change a placement
+	static FRandomStream MakeStream(int32 SeedValue, const FEntry& Entry, int32 BiomeIndex)
+	{
+		uint32 Hash = GetTypeHash(SeedValue);
+		Hash = HashCombineFast(Hash, GetTypeHash(Entry.bInstances));
+		Hash = HashCombineFast(Hash, GetTypeHash(Entry.EntryIndex));
+		Hash = HashCombineFast(Hash, GetTypeHash(BiomeIndex));
+		return FRandomStream((int32)Hash);
+	}
+
+	// Rotation and scale from the biome's stream. Instances grow towards the edge of their biome
+	static FTransform MakeTransform(const FEntry& Entry, const FVector& BiomeCenter, const FVector& SampledLocation, const FVector& Location, FRandomStream& Stream)
+	{
+		if (Entry.bInstances)
+		{
+			FRotator RandomRotation = FRotator(0.0f, 0.0f, Stream.FRandRange(0.0f, 360.f));
+			FVector RandomScale = FVector(FMath::Lerp(0.8f, 1.5f, UKismetMathLibrary::SafeDivide((BiomeCenter - SampledLocation).Length(), Entry.BiomeScale)));
+			return UKismetMathLibrary::MakeTransform(Location, RandomRotation, RandomScale);
+		}
+
+		FRotator RandomRotation = FRotator(0.0f, 0.0f, Stream.FRandRange(0.0f, Entry.RandomRotationRange));
+		FVector RandomScale = FVector(Stream.FRandRange(1.0f, Entry.ScaleRange + 1.0f));
+		return UKismetMathLibrary::MakeTransform(Location, RandomRotation, RandomScale);
+	}
+
+	// One biome on the island surface: a center anywhere the filter allows, then points within BiomeScale of it.
+	// Reads nothing but its arguments, so any number of biomes can run at once
+	static void PlaceBiomeOnSurface(const FIslandSurfaceSampler& Surface, const FIslandSurfaceSampler::FSelection& CenterSelection, const FTransform& SurfaceToWorld, const FEntry& Entry, int32 BiomeIndex, int32 SeedValue, TArray<FTransform>& OutTransforms)
+	{
+		FRandomStream Stream = MakeStream(SeedValue, Entry, BiomeIndex);
+
+		FVector BiomeCenter;
+		if (!Surface.SamplePoint(CenterSelection, Stream, BiomeCenter))
+		{
+			return;
+		}
+
+		const int32 MaxNumberOfLocations = Stream.RandRange(0, Entry.SpawnPerBiome);
+		if (MaxNumberOfLocations == 0)
+		{
+			return;
+		}
+
+		FIslandSurfaceSampler::FSelection PointSelection;
+		Surface.Select(Entry.SurfaceFilter, FVector2D(BiomeCenter), Entry.BiomeScale, PointSelection);
+
+		// Surface points already lie on the mesh, snapping them to the Step grid would lift them off it
+		const FVector WorldBiomeCenter = SurfaceToWorld.TransformPosition(BiomeCenter);
+		for (int32 j = 0; j < MaxNumberOfLocations; j++)
+		{
+			FVector SpawnLocation;
+			if (Surface.SamplePoint(PointSelection, Stream, SpawnLocation))
+			{
+				const FVector WorldLocation = SurfaceToWorld.TransformPosition(SpawnLocation);
+				OutTransforms.Add(MakeTransform(Entry, WorldBiomeCenter, WorldLocation, WorldLocation, Stream));
+			}
+		}
+	}
+
+	// Same as PlaceBiomeOnSurface, with cells of the terrain grid weighted by the entry's biomes instead of triangles
+	static void PlaceBiomeOnGrid(const FIslandTerrainGrid& Grid, const FIslandTerrainGrid::FCellSelection& CenterSelection, const FTransform& SurfaceToWorld, const FEntry& Entry, int32 BiomeIndex, int32 SeedValue, TArray<FTransform>& OutTransforms)
+	{
+		FRandomStream Stream = MakeStream(SeedValue, Entry, BiomeIndex);
+
+		FVector BiomeCenter;
+		if (!Grid.SamplePoint(CenterSelection, Stream, BiomeCenter))
+		{
+			return;
+		}
+
+		const int32 MaxNumberOfLocations = Stream.RandRange(0, Entry.SpawnPerBiome);
+		if (MaxNumberOfLocations == 0)
+		{
+			return;
+		}
+
+		FIslandTerrainGrid::FCellSelection PointSelection;
+		Grid.SelectCells(Entry.BiomeWeights, Entry.SurfaceFilter, FVector2D(BiomeCenter), Entry.BiomeScale, PointSelection);
+
+		const FVector WorldBiomeCenter = SurfaceToWorld.TransformPosition(BiomeCenter);
+		for (int32 j = 0; j < MaxNumberOfLocations; j++)
+		{
+			FVector SpawnLocation;
+			if (Grid.SamplePoint(PointSelection, Stream, SpawnLocation))
+			{
+				const FVector WorldLocation = SurfaceToWorld.TransformPosition(SpawnLocation);
+				OutTransforms.Add(MakeTransform(Entry, WorldBiomeCenter, WorldLocation, WorldLocation, Stream));
+			}
+		}
+	}
+}
+
+ASpawner::ASpawner()
+{
+	PrimaryActorTick.bCanEverTick = false;
+
+	Seed.Initialize(0);
+
+	bAsyncComplete = false;
+	bAutoSpawn = true;
+	bActorSwitch = true;
+
+	Counter = 0;
+	IndexCounter = 0;
+
+	Step = 200.0f;
+
+	PlacementMode = ESpawnPlacementMode::NavMesh;
+
+	SpawnBudgetMs = 2.0f;
+	bInstancesAsDataOnServer = true;
+	SpawnQueueHead = 0;
+	bPlacementFinished = false;
+	bTransformsPrecomputed = false;
+	bSeedFromGameInstance = true;
+	ScheduledJobId = INDEX_NONE;
+}
+
+void ASpawner::BeginPlay()
+{
+	Super::BeginPlay();
+	UGameInstance* GameInstance = UGameplayStatics::GetGameInstance(this);
+	if (bSeedFromGameInstance && GameInstance->GetClass()->ImplementsInterface(UIslandPluginInterface::StaticClass()))
+	{
+		// Retrieve the island seed from the game instance
+		Seed = IIslandPluginInterface::Execute_IslandSeed(GameInstance);
+	}
+
+	if (PlacementMode == ESpawnPlacementMode::IslandSurface)
+	{
+		// Fall back to the first constructor in the level
+		if (!IslandConstructor)
+		{
+			for (TActorIterator<AIslandConstructor> It(GetWorld()); It; ++It)
+			{
+				IslandConstructor = *It;
+				break;
+			}
+		}
+
+		if (IslandConstructor)
+		{
+			IslandConstructor->OnSurfaceReady.AddUObject(this, &ASpawner::OnIslandSurfaceReady);
+		}
+		else
+		{
+			UE_LOG(LogTemp, Error, TEXT("IslandSurface placement needs an IslandConstructor, none found!"));
+		}
+	}
+
+	AsyncLoadClasses();
+}
+
+void ASpawner::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	ReleaseScheduledJob(false);
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void ASpawner::ConfigureForIsland(AIslandConstructor* InConstructor, const FRandomStream& InSeed)
+{
+	IslandConstructor = InConstructor;
+	PlacementMode = ESpawnPlacementMode::IslandSurface;
+	Seed = InSeed;
+	bSeedFromGameInstance = false;
+}
+
+void ASpawner::SetSeed(const FRandomStream& InSeed)
+{
+	Seed = InSeed;
+	bSeedFromGameInstance = false;
+}
+
+int32 ASpawner::SpawnImmediately(TSharedPtr<const FIslandSurfaceSampler> Surface, TSharedPtr<const FIslandTerrainGrid> Grid, const FTransform& SurfaceToWorld)
+{
+	ReleaseSpawnedContent();
+
+	PlacementMode = ESpawnPlacementMode::IslandSurface;
+	InstancePlacements.Reset();
+	Counter = 0;
+
+	ResetSpacingGrid();
+	PrecomputeSurfaceTransforms(Surface, Grid, SurfaceToWorld);
+
+	// Same order as ReadyToSpawn, every actor type and then every instance type
+	for (int32 TypeIndex = 0; TypeIndex < SpawnTypes.Num(); ++TypeIndex)
+	{
+		TSubclassOf<AActor> Class = SpawnTypes[TypeIndex].ClassRef.LoadSynchronous();
+		if (!Class)
+		{
+			continue;
+		}
+
+		TArray<FTransform> Transforms;
+		ComputeTransforms(false, TypeIndex, Transforms);
+		ApplySpacing(false, TypeIndex, Transforms);
+		for (const FTransform& Transform : Transforms)
+		{
+			SpawnQueuedActor({ Class, Transform });
+		}
+	}
+
+	for (int32 InstanceIndex = 0; InstanceIndex < SpawnInstances.Num(); ++InstanceIndex)
+	{
+		if (StoresInstancesAsData())
+		{
+			StoreInstancePlacements(InstanceIndex);
+		}
+		else
+		{
+			SpawnInstances[InstanceIndex].ClassMeshRef.LoadSynchronous();
+			if (UInstancedStaticMeshComponent* InstancedMeshComp = CreateInstanceComponent(SpawnInstances[InstanceIndex]))
+			{
+				GenerateInstances(InstancedMeshComp, InstanceIndex);
+			}
+		}
+	}
+
+	bPlacementFinished = true;
+	return SpawnedActors.Num() + Counter;
+}
+
+void ASpawner::ReleaseSpawnedContent()
+{
+	if (UWorld* World = GetWorld())
+	{
+		// Placement timer and the spawn queue drain
+		World->GetTimerManager().ClearAllTimersForObject(this);
+	}
+
+	SpawnQueue.Reset();
+	SpawnQueueHead = 0;
+
+	for (const TWeakObjectPtr<AActor>& SpawnedActor : SpawnedActors)
+	{
+		if (SpawnedActor.IsValid())
+		{
+			SpawnedActor->Destroy();
+		}
+	}
+	SpawnedActors.Empty();
+	InstancePlacements.Empty();
+
+	ReleaseScheduledJob(false);
+}
+
+void ASpawner::AsyncLoadClasses()
+{
+	if (SpawnTypes.Num() == 0 && SpawnInstances.Num() == 0)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("SpawnTypes is empty."));
+	}
+
+	bAsyncComplete = false;
+
+	// Every type is in flight at once, the streamer works through them by priority
+	TArray<TSharedPtr<FStreamableHandle>> Handles;
+
+	TypeLoadHandles.Reset(SpawnTypes.Num());
+	for (const FSpawnData& SpawnType : SpawnTypes)
+	{
+		TSharedPtr<FStreamableHandle> Handle = RequestSpawnAsset(SpawnType.ClassRef.ToSoftObjectPath(), SpawnType.LoadPriority);
+		TypeLoadHandles.Add(Handle);
+		if (Handle.IsValid())
+		{
+			Handles.Add(Handle);
+		}
+	}
+
+	// Meshes only matter to instanced components, placements kept as data never touch them
+	const bool bLoadInstanceMeshes = !StoresInstancesAsData();
+
+	InstanceLoadHandles.Reset(SpawnInstances.Num());
+	for (const FSpawnInstance& SpawnInstance : SpawnInstances)
+	{
+		TSharedPtr<FStreamableHandle> Handle = bLoadInstanceMeshes ? RequestSpawnAsset(SpawnInstance.ClassMeshRef.ToSoftObjectPath(), SpawnInstance.LoadPriority) : nullptr;
+		InstanceLoadHandles.Add(Handle);
+		if (Handle.IsValid())
+		{
+			Handles.Add(Handle);
+		}
+	}
+
+	FStreamableManager& Streamable = UAssetManager::GetStreamableManager();
+	CombinedLoadHandle = Handles.Num() > 0 ? Streamable.CreateCombinedHandle(Handles) : nullptr;
+	if (CombinedLoadHandle.IsValid() && !CombinedLoadHandle->HasLoadCompleted())
+	{
+		CombinedLoadHandle->BindCompleteDelegate(FStreamableDelegate::CreateUObject(this, &ASpawner::OnAllAsyncClassesCompleted));
+	}
+	else
+	{
+		bAsyncComplete = true;
+	}
+
+	// Spawning goes type by type as soon as each one is resident, no need to wait for the whole batch
+	if (bAutoSpawn)
+	{
+		QueueSpawning();
+	}
+}
+
+void ASpawner::QueueSpawning()
+{
+	UIslandGenerationSubsystem* Scheduler = UWorld::GetSubsystem<UIslandGenerationSubsystem>(GetWorld());
+	if (!Scheduler)
+	{
+		SpawnRandom();
+		return;
+	}
+
+	ReleaseScheduledJob(false);
+
+	// Spawn bursts of every spawner in the world take turns, the island nearest to a player first
+	const FVector Location = IslandConstructor ? IslandConstructor->GetActorLocation() : GetActorLocation();
+	TWeakObjectPtr<ASpawner> WeakThis(this);
+	ScheduledJobId = Scheduler->QueueJob(this, EIslandJobType::Spawning, Location, 0, [WeakThis]()
+	{
+		if (ASpawner* Spawner = WeakThis.Get())
+		{
+			Spawner->SpawnRandom();
+		}
+	});
+}
+
+void ASpawner::ReleaseScheduledJob(bool bCompleted)
+{
+	if (ScheduledJobId == INDEX_NONE)
+	{
+		return;
+	}
+
+	if (UIslandGenerationSubsystem* Scheduler = UWorld::GetSubsystem<UIslandGenerationSubsystem>(GetWorld()))
+	{
+		if (bCompleted)
+		{
+			Scheduler->CompleteJob(ScheduledJobId);
+		}
+		else
+		{
+			Scheduler->CancelJob(ScheduledJobId);
+		}
+	}
+
+	ScheduledJobId = INDEX_NONE;
+}
+
+TSharedPtr<FStreamableHandle> ASpawner::RequestSpawnAsset(const FSoftObjectPath& Path, int32 Priority)
+{
+	if (Path.IsNull())
+	{
+		return nullptr;
+	}
+
+	FStreamableManager& Streamable = UAssetManager::GetStreamableManager();
+	return Streamable.RequestAsyncLoad(Path, FStreamableDelegate::CreateUObject(this, &ASpawner::OnAsyncClassCompleted), Priority);
+}
+
+void ASpawner::OnAsyncClassCompleted()
+{
+	// ReadyToSpawn may be waiting on exactly this type, don't sit out the rest of the timer interval
+	if (GetWorld()->GetTimerManager().IsTimerActive(NavCheckHandle))
+	{
+		ReadyToSpawn();
+	}
+}
+
+void ASpawner::OnAllAsyncClassesCompleted()
+{
+	UE_LOG(LogTemp, Warning, TEXT("Async load completed for %d spawn types"), SpawnTypes.Num() + SpawnInstances.Num());
+
+	bAsyncComplete = true;
+}
+
+bool ASpawner::IsCurrentTypeLoaded() const
+{
+	const TArray<TSharedPtr<FStreamableHandle>>& Handles = bActorSwitch ? TypeLoadHandles : InstanceLoadHandles;
+	if (!Handles.IsValidIndex(IndexCounter) || !Handles[IndexCounter].IsValid())
+	{
+		return true;
+	}
+
+	// A failed load counts as done too, GenerateAssets skips a missing class
+	return Handles[IndexCounter]->HasLoadCompleted() || Handles[IndexCounter]->WasCanceled();
+}
+
+void ASpawner::SpawnRandom()
+{
+
+	GetWorld()->GetTimerManager().SetTimerForNextTick([this]()
+	{
+			Counter = 0;
+			IndexCounter = 0;
+	});
+
+	bPlacementFinished = false;
+	bTransformsPrecomputed = false;
+	InstancePlacements.Reset();
+
+	ResetSpacingGrid();
+
+	FTimerDelegate NavCheckDelegate;
+	NavCheckDelegate.BindUFunction(this, FName("ReadyToSpawn"));
+
+	// Set a recurring timer (0.5s interval) to check if we're ready to spawn
+	// The initial delay is -0.5s, effectively meaning start almost immediately
+	GetWorld()->GetTimerManager().SetTimer(NavCheckHandle, NavCheckDelegate, 0.5f, true, -0.5f);
+}
+
+void ASpawner::ResetSpacingGrid()
+{
+	// Spacing holds across every type of this pass, in spawn order
+	float MaxSpacing = 0.0f;
+	for (const FSpawnData& SpawnType : SpawnTypes)
+	{
+		MaxSpacing = FMath::Max3(MaxSpacing, SpawnType.MinSpacing, SpawnType.ExclusionRadius);
+	}
+	for (const FSpawnInstance& SpawnInstance : SpawnInstances)
+	{
+		MaxSpacing = FMath::Max3(MaxSpacing, SpawnInstance.MinSpacing, SpawnInstance.ExclusionRadius);
+	}
+	SpacingGrid = MakeShared<FSpawnSpacingGrid>(FMath::Max3(MaxSpacing, Step, 100.0f));
+}
+
+void ASpawner::OnIslandSurfaceReady(AIslandConstructor* Constructor)
+{
+	// A regenerated island invalidates anything computed on the old surface
+	bTransformsPrecomputed = false;
+
+	// Don't sit out the rest of the timer interval, the surface is all we were waiting for
+	if (GetWorld()->GetTimerManager().IsTimerActive(NavCheckHandle))
+	{
+		ReadyToSpawn();
+	}
+}
+
+bool ASpawner::IsPlacementReady() const
+{
+	if (PlacementMode == ESpawnPlacementMode::IslandSurface)
+	{
+		return IslandConstructor && IslandConstructor->GetSurfaceSampler().IsValid();
+	}
+
+	UNavigationSystemV1* NavSystem = UNavigationSystemV1::GetCurrent(GetWorld());
+	if (!NavSystem)
+	{
+		UE_LOG(LogTemp, Error, TEXT("NavSystem invalid!"));
+		return false;
+	}
+
+	// Check if the navigation system is not being built or locked
+	return !NavSystem->IsNavigationBeingBuiltOrLocked(this);
+}
+
+void ASpawner::ReadyToSpawn()
+{
+	if (IsCurrentTypeLoaded() && IsPlacementReady())
+	{
+		GetWorld()->GetTimerManager().PauseTimer(NavCheckHandle);
+
+		if (bActorSwitch)
+		{
+			if (SpawnTypes.IsValidIndex(IndexCounter))
+			{
+				TSubclassOf<AActor> SpawnObject = SpawnTypes[IndexCounter].ClassRef.Get();
+				GenerateAssets(SpawnObject, IndexCounter);
+				IndexCounter++;
+			}
+			else if (SpawnTypes.Num() > 0)
+			{
+				UE_LOG(LogTemp, Error, TEXT("IndexCounter is out of bounds for SpawnTypes."));
+				return;
+			}
+
+			// Instances follow on the next timer fire
+			if (IndexCounter >= SpawnTypes.Num())
+			{
+				IndexCounter = 0;
+				bActorSwitch = false;
+			}
+			GetWorld()->GetTimerManager().UnPauseTimer(NavCheckHandle);
+		}
+		else
+		{
+			if (SpawnInstances.IsValidIndex(IndexCounter))
+			{
+				if (StoresInstancesAsData())
+				{
+					StoreInstancePlacements(IndexCounter);
+				}
+				else if (UInstancedStaticMeshComponent* InstancedMeshComp = CreateInstanceComponent(SpawnInstances[IndexCounter]))
+				{
+					GenerateInstances(InstancedMeshComp, IndexCounter);
+				}
+				IndexCounter++;
+				if (IndexCounter >= SpawnInstances.Num())
+				{
+					FinishSpawning();
+				}
+				else
+				{
+					GetWorld()->GetTimerManager().UnPauseTimer(NavCheckHandle);
+				}
+			}
+			else if (SpawnInstances.Num() == 0)
+			{
+				FinishSpawning();
+			}
+			else
+			{
+				UE_LOG(LogTemp, Error, TEXT("IndexCounter is out of bounds for SpawnInstances."));
+			}
+		}
+	}
+}
+
+void ASpawner::GenerateAssets(TSubclassOf<AActor> Class, int32 TypeIndex)
+{
+	if (!Class) { return; }
+
+	TArray<FTransform> Transforms;
+	ComputeTransforms(false, TypeIndex, Transforms);
+	ApplySpacing(false, TypeIndex, Transforms);
+
+	// Only queue the transforms here, DrainSpawnQueue spawns them a frame budget at a time
+	const bool bWasIdle = SpawnQueueHead >= SpawnQueue.Num();
+	for (const FTransform& Transform : Transforms)
+	{
+		SpawnQueue.Add({ Class, Transform });
+	}
+
+	if (bWasIdle && SpawnQueueHead < SpawnQueue.Num())
+	{
+		DrainSpawnQueue();
+	}
+}
+
+void ASpawner::DrainSpawnQueue()
+{
+	UWorld* World = GetWorld();
+	if (!World || SpawnQueueHead >= SpawnQueue.Num()) { return; }
+
+	TRACE_CPUPROFILER_EVENT_SCOPE(IslandGenerator_DrainSpawnQueue);
+
+	const double StartTime = FPlatformTime::Seconds();
+	const double BudgetSeconds = SpawnBudgetMs / 1000.0;
+
+	// At least one actor per frame, so a single heavy Blueprint can't stall the queue
+	do
+	{
+		SpawnQueuedActor(SpawnQueue[SpawnQueueHead++]);
+	}
+	while (SpawnQueueHead < SpawnQueue.Num() && (BudgetSeconds <= 0.0 || FPlatformTime::Seconds() - StartTime < BudgetSeconds));
+
+	//Send Progress Event to GameMode
+	AGameModeBase* GameMode = UGameplayStatics::GetGameMode(this);
+	if (GameMode && GameMode->GetClass()->ImplementsInterface(UIslandPluginInterface::StaticClass()))
+	{
+		IIslandPluginInterface::Execute_SpawningProgress(GameMode, SpawnQueueHead, SpawnQueue.Num());
+	}
+
+	if (SpawnQueueHead < SpawnQueue.Num())
+	{
+		World->GetTimerManager().SetTimerForNextTick(this, &ASpawner::DrainSpawnQueue);
+		return;
+	}
+
+	if (bPlacementFinished)
+	{
+		NotifySpawningComplete();
+	}
+}
+
+AActor* ASpawner::SpawnQueuedActor(const FQueuedSpawn& Spawn)
+{
+	// Deferred so the construction script runs inside this slice, with the final transform, exactly once
+	AActor* Actor = GetWorld()->SpawnActorDeferred<AActor>(Spawn.Class, Spawn.Transform, this);
+	if (Actor)
+	{
+		Actor->FinishSpawning(Spawn.Transform);
+		SpawnedActors.Add(Actor);
+	}
+	return Actor;
+}
+
+void ASpawner::GenerateInstances(UInstancedStaticMeshComponent* MeshClass, int32 InstanceIndex)
+{
+	// Compute every placement first and submit them in one go, so render state is only rebuilt once
+	TArray<FTransform> InstanceTransforms;
+	ComputeTransforms(true, InstanceIndex, InstanceTransforms);
+	ApplySpacing(true, InstanceIndex, InstanceTransforms);
+
+	// Placements are in world space, same as the per-instance adds were
+	MeshClass->AddInstances(InstanceTransforms, false, true);
+
+	Counter += InstanceTransforms.Num();
+}
+
+void ASpawner::StoreInstancePlacements(int32 InstanceIndex)
+{
+	// Same transforms and spacing as the component path, so server gameplay sees what clients render
+	TArray<FTransform> InstanceTransforms;
+	ComputeTransforms(true, InstanceIndex, InstanceTransforms);
+	ApplySpacing(true, InstanceIndex, InstanceTransforms);
+
+	Counter += InstanceTransforms.Num();
+
+	InstancePlacements.SetNum(SpawnInstances.Num());
+	InstancePlacements[InstanceIndex] = MoveTemp(InstanceTransforms);
+}
+
+bool ASpawner::StoresInstancesAsData() const
+{
+	return bInstancesAsDataOnServer && GetNetMode() == NM_DedicatedServer;
+}
+
+void ASpawner::ComputeTransforms(bool bInstances, int32 EntryIndex, TArray<FTransform>& OutTransforms)
+{
+	OutTransforms.Reset();
+
+	if (PlacementMode == ESpawnPlacementMode::IslandSurface)
+	{
+		// The first type to spawn computes every type at once, the rest just pick up their share
+		if (!bTransformsPrecomputed)
+		{
+			PrecomputeSurfaceTransforms();
+		}
+
+		TArray<TArray<FTransform>>& Precomputed = bInstances ? PrecomputedInstanceTransforms : PrecomputedTypeTransforms;
+		if (Precomputed.IsValidIndex(EntryIndex))
+		{
+			OutTransforms = MoveTemp(Precomputed[EntryIndex]);
+		}
+		return;
+	}
+
+	// Navmesh queries stay on the game thread, one biome after the other
+	UNavigationSystemV1* NavSystem = UNavigationSystemV1::GetCurrent(GetWorld());
+	if (!NavSystem)
+	{
+		UE_LOG(LogTemp, Error, TEXT("NavSystem invalid!"));
+		return;
+	}
+
+	const SpawnerPlacement::FEntry Entry = SpawnerPlacement::MakeEntry(SpawnTypes, SpawnInstances, bInstances, EntryIndex);
+
+	for (int32 i = 0; i < Entry.BiomeCount; i++)
+	{
+		FRandomStream Stream = SpawnerPlacement::MakeStream(Seed.GetInitialSeed(), Entry, i);
+
+		FVector RandomLocation = FVector(0);
+
+		FNavLocation NavLocationFirst;
+
+		bool bFoundFirst = NavSystem->GetRandomPointInNavigableRadius(FVector(0.0f, 0.0f, 0.0f), 10000.f, NavLocationFirst, NavData);
+		if (bFoundFirst)
+		{
+			RandomLocation = NavLocationFirst.Location;
+		}
+
+		int32 MaxNumberOfLocations = UKismetMathLibrary::RandomIntegerInRangeFromStream(Stream, 0, Entry.SpawnPerBiome);
+
+		for (int32 j = 0; j < MaxNumberOfLocations; j++)
+		{
+			FVector RandomSpawnLocation = FVector(0);
+
+			FNavLocation NavLocationSecond;
+
+			bool bFoundSecond = NavSystem->GetRandomPointInNavigableRadius(RandomLocation, Entry.BiomeScale, NavLocationSecond, NavData);
+			if (bFoundSecond)
+			{
+				RandomSpawnLocation = NavLocationSecond.Location;
+			}
+			else
+			{
+				UE_LOG(LogTemp, Warning, TEXT("Navigation Mesh is not working"))
+			}
+
+			OutTransforms.Add(SpawnerPlacement::MakeTransform(Entry, RandomLocation, RandomSpawnLocation, SteppedPosition(RandomSpawnLocation), Stream));
+		}
+	}
+}
+
+void ASpawner::ApplySpacing(bool bInstances, int32 EntryIndex, TArray<FTransform>& Transforms)
+{
+	if (!SpacingGrid.IsValid())
+	{
+		return;
+	}
+
+	const SpawnerPlacement::FEntry Entry = SpawnerPlacement::MakeEntry(SpawnTypes, SpawnInstances, bInstances, EntryIndex);
+
+	// Actor types and instance types share the grid, instance groups come after every actor type
+	const int32 Group = bInstances ? SpawnTypes.Num() + EntryIndex : EntryIndex;
+
+	// Placements are tested in their deterministic order, so the same ones are dropped on every machine
+	const int32 NumCandidates = Transforms.Num();
+	Transforms.RemoveAll([this, &Entry, Group](const FTransform& Transform)
+	{
+		return !SpacingGrid->TryAdd(Transform.GetLocation(), Group, Entry.MinSpacing, Entry.ExclusionRadius);
+	});
+
+	if (Transforms.Num() < NumCandidates)
+	{
+		UE_LOG(LogTemp, Log, TEXT("Dropped %d of %d placements that were too close to others"), NumCandidates - Transforms.Num(), NumCandidates);
+	}
+}
+
+void ASpawner::PrecomputeSurfaceTransforms()
+{
+	if (!IslandConstructor)
+	{
+		PrecomputeSurfaceTransforms(nullptr, nullptr, FTransform::Identity);
+		return;
+	}
+
+	// The surface is in constructor space, placements go out in world space
+	PrecomputeSurfaceTransforms(IslandConstructor->GetSurfaceSampler(), IslandConstructor->GetTerrainGrid(), IslandConstructor->GetActorTransform());
+}
+
+void ASpawner::PrecomputeSurfaceTransforms(TSharedPtr<const FIslandSurfaceSampler> Surface, TSharedPtr<const FIslandTerrainGrid> Grid, const FTransform& SurfaceToWorld)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(IslandGenerator_PrecomputeSurfaceTransforms);
+
+	bTransformsPrecomputed = true;
+	PrecomputedTypeTransforms.Reset();
+	PrecomputedInstanceTransforms.Reset();
+
+	if (!Surface.IsValid())
+	{
+		UE_LOG(LogTemp, Error, TEXT("Island surface is not ready!"));
+		return;
+	}
+
+	const int32 SeedValue = Seed.GetInitialSeed();
+
+	TArray<SpawnerPlacement::FEntry> Entries;
+	for (int32 Index = 0; Index < SpawnTypes.Num(); ++Index)
+	{
+		Entries.Add(SpawnerPlacement::MakeEntry(SpawnTypes, SpawnInstances, false, Index));
+	}
+	for (int32 Index = 0; Index < SpawnInstances.Num(); ++Index)
+	{
+		Entries.Add(SpawnerPlacement::MakeEntry(SpawnTypes, SpawnInstances, true, Index));
+	}
+
+	// Entries with biome weights place on the terrain grid's classified cells, the rest on the surface triangles
+	if (!Grid.IsValid() || Grid->IsEmpty())
+	{
+		Grid.Reset();
+		for (const SpawnerPlacement::FEntry& Entry : Entries)
+		{
+			if (Entry.BiomeWeights.Num() > 0)
+			{
+				UE_LOG(LogTemp, Warning, TEXT("Island has no terrain grid, biome weights are ignored. Set TerrainGridResolution above 0"));
+				break;
+			}
+		}
+	}
+
+	auto UsesGrid = [&Grid](const SpawnerPlacement::FEntry& Entry)
+	{
+		return Grid.IsValid() && Entry.BiomeWeights.Num() > 0;
+	};
+
+	// Biome center candidates only depend on the entry's filter and weights
+	TArray<FIslandSurfaceSampler::FSelection> CenterSelections;
+	TArray<FIslandTerrainGrid::FCellSelection> CenterCellSelections;
+	CenterSelections.SetNum(Entries.Num());
+	CenterCellSelections.SetNum(Entries.Num());
+	ParallelFor(Entries.Num(), [&](int32 EntryIndex)
+	{
+		const SpawnerPlacement::FEntry& Entry = Entries[EntryIndex];
+		if (UsesGrid(Entry))
+		{
+			Grid->SelectCells(Entry.BiomeWeights, Entry.SurfaceFilter, FVector2D::ZeroVector, 0.0f, CenterCellSelections[EntryIndex]);
+		}
+		else
+		{
+			Surface->Select(Entry.SurfaceFilter, FVector2D::ZeroVector, 0.0f, CenterSelections[EntryIndex]);
+		}
+	});
+
+	// Once per entry, otherwise a biome filter no cell passes just places nothing without a word
+	for (int32 EntryIndex = 0; EntryIndex < Entries.Num(); ++EntryIndex)
+	{
+		const SpawnerPlacement::FEntry& Entry = Entries[EntryIndex];
+		if (UsesGrid(Entry) && CenterCellSelections[EntryIndex].IsEmpty())
+		{
+			const FString AssetName = Entry.bInstances ? SpawnInstances[Entry.EntryIndex].ClassMeshRef.GetAssetName() : SpawnTypes[Entry.EntryIndex].ClassRef.GetAssetName();
+			UE_LOG(LogTemp, Warning, TEXT("%s[%d] (%s) places nothing, no terrain cell matches its BiomeWeights and SurfaceFilter"),
+				Entry.bInstances ? TEXT("SpawnInstances") : TEXT("SpawnTypes"), Entry.EntryIndex, *AssetName);
+		}
+	}
+
+	// One job per biome of every entry, each with its own substream
+	TArray<FIntPoint> Jobs;
+	for (int32 EntryIndex = 0; EntryIndex < Entries.Num(); ++EntryIndex)
+	{
+		for (int32 BiomeIndex = 0; BiomeIndex < Entries[EntryIndex].BiomeCount; ++BiomeIndex)
+		{
+			Jobs.Add(FIntPoint(EntryIndex, BiomeIndex));
+		}
+	}
+
+	TArray<TArray<FTransform>> JobTransforms;
+	JobTransforms.SetNum(Jobs.Num());
+	ParallelFor(Jobs.Num(), [&](int32 JobIndex)
+	{
+		const FIntPoint Job = Jobs[JobIndex];
+		if (UsesGrid(Entries[Job.X]))
+		{
+			SpawnerPlacement::PlaceBiomeOnGrid(*Grid, CenterCellSelections[Job.X], SurfaceToWorld, Entries[Job.X], Job.Y, SeedValue, JobTransforms[JobIndex]);
+		}
+		else
+		{
+			SpawnerPlacement::PlaceBiomeOnSurface(*Surface, CenterSelections[Job.X], SurfaceToWorld, Entries[Job.X], Job.Y, SeedValue, JobTransforms[JobIndex]);
+		}
+	});
+
+	// Stitched back in biome order, so the result never depends on which worker finished first
+	PrecomputedTypeTransforms.SetNum(SpawnTypes.Num());
+	PrecomputedInstanceTransforms.SetNum(SpawnInstances.Num());
+	for (int32 JobIndex = 0; JobIndex < Jobs.Num(); ++JobIndex)
+	{
+		const SpawnerPlacement::FEntry& Entry = Entries[Jobs[JobIndex].X];
+		TArray<TArray<FTransform>>& Precomputed = Entry.bInstances ? PrecomputedInstanceTransforms : PrecomputedTypeTransforms;
+		Precomputed[Entry.EntryIndex].Append(JobTransforms[JobIndex]);
+	}
+}
+
+UInstancedStaticMeshComponent* ASpawner::CreateInstanceComponent(const FSpawnInstance& SpawnInstance)
+{
+	UInstancedStaticMeshComponent* InstancedMeshComp = nullptr;
+	if (SpawnInstance.bUseHierarchicalInstances)
+	{
+		InstancedMeshComp = NewObject<UHierarchicalInstancedStaticMeshComponent>(this);
+	}
+	else
+	{
+		InstancedMeshComp = NewObject<UInstancedStaticMeshComponent>(this);
+	}
+
+	if (InstancedMeshComp)
+	{
+		InstancedMeshComp->RegisterComponent();
+		InstancedMeshComp->AttachToComponent(RootComponent, FAttachmentTransformRules::KeepRelativeTransform);
+		InstancedMeshComp->SetStaticMesh(SpawnInstance.ClassMeshRef.Get());
+		InstancedMeshComp->SetCullDistances(SpawnInstance.InstanceStartCullDistance, SpawnInstance.InstanceEndCullDistance);
+	}
+
+	return InstancedMeshComp;
+}
+
+void ASpawner::FinishSpawning()
+{
+	GetWorld()->GetTimerManager().ClearTimer(NavCheckHandle);
+	bPlacementFinished = true;
+
+	// Actors may still be waiting in the queue, the last drained slice reports completion then
+	if (SpawnQueueHead >= SpawnQueue.Num())
+	{
+		NotifySpawningComplete();
+	}
+}
+
+void ASpawner::NotifySpawningComplete()
+{
+	UE_LOG(LogTemp, Warning, TEXT("Spawn finished"))
+
+	// Kept until now so the progress covers every type, not just the one being drained
+	SpawnQueue.Reset();
+	SpawnQueueHead = 0;
+
+	//Send Completed Event to GameMode
+	AGameModeBase* GameMode = UGameplayStatics::GetGameMode(this);
+	if (GameMode && GameMode->GetClass()->ImplementsInterface(UIslandPluginInterface::StaticClass()))
+	{
+		IIslandPluginInterface::Execute_SpawningComplete(GameMode);
+	}
+
+	ReleaseScheduledJob(true);
+}
+
+float ASpawner::GetSpawnProgress() const
+{
+	if (bPlacementFinished && SpawnQueueHead >= SpawnQueue.Num())
+	{
+		return 1.0f;
+	}
+
+	return SpawnQueue.Num() > 0 ? (float)SpawnQueueHead / SpawnQueue.Num() : 0.0f;
+}
+
+TArray<FTransform> ASpawner::GetInstancePlacements(int32 InstanceIndex) const
+{
+	return InstancePlacements.IsValidIndex(InstanceIndex) ? InstancePlacements[InstanceIndex] : TArray<FTransform>();
+}
+
+FVector ASpawner::SteppedPosition(FVector Param)
+{
+	if (Step <= 0.0f)
+	{
+		return FVector(Param.X, Param.Y, 0.0f);
+	}
+
+	// Snap the X and Y coordinates to multiples of Step
+	float RoundedX = FMath::RoundToFloat(Param.X / Step) * Step;
+	float RoundedY = FMath::RoundToFloat(Param.Y / Step) * Step;
+
+	return FVector(RoundedX, RoundedY, 0.0f);
 }
\ No newline at end of file
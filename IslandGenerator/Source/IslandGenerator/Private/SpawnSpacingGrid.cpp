@@ -0,0 +1,61 @@
+// The source code, authored by Zoxemik in 2025
+
+#include "SpawnSpacingGrid.h"
+
+FSpawnSpacingGrid::FSpawnSpacingGrid(float InCellSize)
+	: CellSize(FMath::Max(InCellSize, 1.0f))
+{
+}
+
+FIntPoint FSpawnSpacingGrid::GetCell(const FVector2f& Location) const
+{
+	return FIntPoint(FMath::FloorToInt32(Location.X / CellSize), FMath::FloorToInt32(Location.Y / CellSize));
+}
+
+bool FSpawnSpacingGrid::TryAdd(const FVector& Location, int32 Group, float MinSpacing, float ExclusionRadius)
+{
+	const FVector2f Location2f((float)Location.X, (float)Location.Y);
+	const FIntPoint Cell = GetCell(Location2f);
+
+	// Nothing further away than this can reject the placement
+	const float SearchRadius = FMath::Max3(MinSpacing, ExclusionRadius, MaxExclusionRadius);
+	const int32 CellRange = FMath::CeilToInt32(SearchRadius / CellSize);
+
+	for (int32 Y = Cell.Y - CellRange; Y <= Cell.Y + CellRange; ++Y)
+	{
+		for (int32 X = Cell.X - CellRange; X <= Cell.X + CellRange; ++X)
+		{
+			const TArray<FPoint>* Points = Cells.Find(FIntPoint(X, Y));
+			if (!Points)
+			{
+				continue;
+			}
+
+			for (const FPoint& Point : *Points)
+			{
+				const float DistanceSquared = FVector2f::DistSquared(Point.Location, Location2f);
+				if (Point.Group == Group)
+				{
+					// Two placements of one type on the same spot are always a duplicate, spacing or not
+					if (DistanceSquared < FMath::Max(MinSpacing * MinSpacing, UE_KINDA_SMALL_NUMBER))
+					{
+						return false;
+					}
+				}
+				else
+				{
+					const float Required = FMath::Max(ExclusionRadius, Point.ExclusionRadius);
+					if (DistanceSquared < Required * Required)
+					{
+						return false;
+					}
+				}
+			}
+		}
+	}
+
+	Cells.FindOrAdd(Cell).Add({ Location2f, Group, ExclusionRadius });
+	MaxExclusionRadius = FMath::Max(MaxExclusionRadius, ExclusionRadius);
+	NumPoints++;
+	return true;
+}
@@ -0,0 +1,41 @@
+// The source code, authored by Zoxemik in 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+// Accepted spawn placements hashed into square cells on the XY plane, so a spacing test only looks at the
+// few cells around the candidate. It only filters the candidates it is given, in order: a rejected placement is
+// dropped, not retried, so the result is a minimum distance thinning of the candidates rather than a Poisson-disk fill
+class FSpawnSpacingGrid
+{
+public:
+	// CellSize should be about the largest spacing or exclusion radius in use, so most tests stay within 3x3 cells
+	explicit FSpawnSpacingGrid(float InCellSize);
+
+	// Adds the placement if it is at least MinSpacing from every placement of its own group (and never on top of one)
+	// and, from every other group, at least the larger of both exclusion radii. Returns false if it was rejected
+	bool TryAdd(const FVector& Location, int32 Group, float MinSpacing, float ExclusionRadius);
+
+	int32 Num() const { return NumPoints; }
+
+private:
+	struct FPoint
+	{
+		FVector2f Location;
+
+		int32 Group;
+
+		float ExclusionRadius;
+	};
+
+	FIntPoint GetCell(const FVector2f& Location) const;
+
+	TMap<FIntPoint, TArray<FPoint>> Cells;
+
+	float CellSize;
+
+	float MaxExclusionRadius = 0.0f;
+
+	int32 NumPoints = 0;
+};
@@ -0,0 +1,49 @@
+// The source code, authored by Zoxemik in 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "IslandBiome.generated.h"
+
+UENUM(BlueprintType)
+enum class EIslandBiome : uint8
+{
+	/** Land within ShoreWidth of the water */
+	Shore,
+
+	/** Gentle ground below UplandHeight, whatever no other biome claims */
+	Lowland,
+
+	/** Gentle ground at or above UplandHeight */
+	Upland,
+
+	/** Ground steeper than CliffSlopeAngle, wins over every other biome */
+	Cliff,
+
+	/** Ground within InteriorRadius of its island's center */
+	Interior,
+
+	MAX UMETA(Hidden)
+};
+
+USTRUCT(BlueprintType)
+struct FIslandBiomeRules
+{
+    GENERATED_USTRUCT_BODY()
+
+    /** Steeper ground is Cliff, in degrees */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Biome", meta = (ClampMin = "0", ClampMax = "90"))
+    float CliffSlopeAngle = 35.0f;
+
+    /** How far inland from the water the Shore reaches, in world units */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Biome", meta = (ClampMin = "0"))
+    float ShoreWidth = 400.0f;
+
+    /** Height, relative to the island constructor, from which gentle ground is Upland. The top cut is at 0 */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Biome")
+    float UplandHeight = -100.0f;
+
+    /** Share of an island's shore radius around its center that is Interior */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Biome", meta = (ClampMin = "0", ClampMax = "1"))
+    float InteriorRadius = 0.3f;
+};
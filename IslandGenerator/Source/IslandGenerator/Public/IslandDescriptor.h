@@ -0,0 +1,27 @@
+// The source code, authored by Zoxemik in 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "IslandDescriptor.generated.h"
+
+USTRUCT(BlueprintType)
+struct FIslandDescriptor
+{
+    GENERATED_USTRUCT_BODY()
+
+    /** Center of the island on the water plane, in world space */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Island Generator")
+    FVector Center = FVector::ZeroVector;
+
+    /** Radius of the cone at its base, under the water */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Island Generator")
+    float Radius = 0.0f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Island Generator")
+    float Height = 0.0f;
+
+    /** Radius of the widest visible slice of the island, where its cliffs meet the bottom cut */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Island Generator")
+    float ShoreRadius = 0.0f;
+};
@@ -0,0 +1,29 @@
+// The source code, authored by Zoxemik in 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "IslandStageStats.h"
+#include "IslandGenerationStats.generated.h"
+
+USTRUCT(BlueprintType)
+struct FIslandGenerationStats
+{
+    GENERATED_USTRUCT_BODY()
+
+    /** Every stage that ran, in pipeline order */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Island Generator")
+    TArray<FIslandStageStats> Stages;
+
+    /** Wall time from the start of the build until the mesh was in the component */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Island Generator")
+    float TotalTimeMs = 0.0f;
+
+    /** Highest process physical memory use sampled at the stage boundaries */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Island Generator")
+    float PeakMemoryMB = 0.0f;
+
+    /** The mesh was streamed from the mesh cache, the generation stages did not run */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Island Generator")
+    bool bFromCache = false;
+};
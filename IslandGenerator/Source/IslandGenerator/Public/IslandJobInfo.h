@@ -0,0 +1,31 @@
+// The source code, authored by Zoxemik in 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "IslandJobType.h"
+#include "IslandJobInfo.generated.h"
+
+USTRUCT(BlueprintType)
+struct FIslandJobInfo
+{
+    GENERATED_USTRUCT_BODY()
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Island Generator")
+    int32 JobId = INDEX_NONE;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Island Generator")
+    EIslandJobType Type = EIslandJobType::Generation;
+
+    /** Island constructor or spawner that queued the job */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Island Generator")
+    TWeakObjectPtr<AActor> Owner;
+
+    /** Time the job spent in the queue before a slot was free */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Island Generator")
+    float WaitTimeMs = 0.0f;
+
+    /** Time from the start of the job until its owner reported it complete */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Island Generator")
+    float RunTimeMs = 0.0f;
+};
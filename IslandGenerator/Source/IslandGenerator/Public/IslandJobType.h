@@ -0,0 +1,16 @@
+// The source code, authored by Zoxemik in 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "IslandJobType.generated.h"
+
+UENUM(BlueprintType)
+enum class EIslandJobType : uint8
+{
+	/** One island constructor mesh build, runs on a worker thread */
+	Generation,
+
+	/** One spawner pass, loads its classes and spawns on the game thread */
+	Spawning
+};
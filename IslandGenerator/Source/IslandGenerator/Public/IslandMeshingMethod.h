@@ -0,0 +1,19 @@
+// The source code, authored by Zoxemik in 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "IslandMeshingMethod.generated.h"
+
+UENUM(BlueprintType)
+enum class EIslandMeshingMethod : uint8
+{
+	/** Appends the cones and voxelizes the triangle soup with Solidify, over the footprint of the islands only */
+	VoxelSolidify,
+
+	/** Meshes a smooth-union signed distance field of the cones and base slab directly */
+	ImplicitSDF,
+
+	/** Rasterizes the cones into a 2D height grid and triangulates only the top surface and cliffs */
+	Heightfield
+};
@@ -0,0 +1,19 @@
+// The source code, authored by Zoxemik in 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "IslandOverlapMode.generated.h"
+
+UENUM(BlueprintType)
+enum class EIslandOverlapMode : uint8
+{
+	/** Keeps every rolled cone, overlapping or not */
+	Allow,
+
+	/** Drops cones that sit fully inside a bigger one and add no land */
+	CullContained,
+
+	/** Also drops cones whose shoreline touches a bigger island, every island stays separate */
+	Separate
+};
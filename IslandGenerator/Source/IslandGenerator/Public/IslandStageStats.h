@@ -0,0 +1,27 @@
+// The source code, authored by Zoxemik in 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "IslandStageStats.generated.h"
+
+USTRUCT(BlueprintType)
+struct FIslandStageStats
+{
+    GENERATED_USTRUCT_BODY()
+
+    /** Name of the pipeline stage, e.g. Solidify or TopCut */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Island Generator")
+    FName StageName;
+
+    /** Wall time the stage took */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Island Generator")
+    float TimeMs = 0.0f;
+
+    /** Mesh size once the stage finished */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Island Generator")
+    int32 VertexCount = 0;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Island Generator")
+    int32 TriangleCount = 0;
+};
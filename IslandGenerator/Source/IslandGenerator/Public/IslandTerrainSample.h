@@ -0,0 +1,35 @@
+// The source code, authored by Zoxemik in 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "IslandBiome.h"
+#include "IslandTerrainSample.generated.h"
+
+USTRUCT(BlueprintType)
+struct FIslandTerrainSample
+{
+    GENERATED_USTRUCT_BODY()
+
+    /** The location lies over the island surface, everything else below is left at its default */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Island Generator")
+    bool bIsLand = false;
+
+    /** Index into the constructor's GetIslands, INDEX_NONE over water */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Island Generator")
+    int32 IslandIndex = INDEX_NONE;
+
+    /** World space height of the top surface */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Island Generator")
+    float Height = 0.0f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Island Generator")
+    FVector Normal = FVector::UpVector;
+
+    /** Angle between the surface and the horizontal, in degrees */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Island Generator")
+    float SlopeAngle = 0.0f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Island Generator")
+    EIslandBiome Biome = EIslandBiome::Lowland;
+};
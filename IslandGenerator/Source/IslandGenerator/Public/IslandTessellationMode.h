@@ -0,0 +1,17 @@
+// The source code, authored by Zoxemik in 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "IslandTessellationMode.generated.h"
+
+UENUM(BlueprintType)
+enum class EIslandTessellationMode : uint8
+{
+	/** PN tessellation of every triangle, IslandTessellationLevel times along each edge */
+	Uniform,
+
+	/** Splits only the edges where the curved surface departs from the flat triangles, coast first, down to the
+	    edge length IslandTessellationLevel would reach. Flat plateaus and anything the plane cuts remove stay coarse */
+	Adaptive
+};
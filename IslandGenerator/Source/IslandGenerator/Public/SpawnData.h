@@ -1,32 +1,53 @@
-// The source code, authored by Zoxemik in 2025
-
-#pragma once
-
-#include "CoreMinimal.h"
-#include "SpawnData.generated.h"
-
-USTRUCT(BlueprintType)
-struct FSpawnData
-{
-    GENERATED_USTRUCT_BODY()
-
-    /** A reference to the Actor class you want to spawn or track */
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Biome")
-    TSoftClassPtr<AActor> ClassRef;
-
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Biome")
-    float BiomeScale;
-
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Biome")
-    int32 BiomeCount;
-
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Biome")
-    int32 SpawnPerBiome;
-
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Biome")
-    float RandomRotationRange;
-
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Biome")
-    float ScaleRange;
-    
+// The source code, authored by Zoxemik in 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SpawnPlacement.h"
+#include "SpawnData.generated.h"
+
+USTRUCT(BlueprintType)
+struct FSpawnData
+{
+    GENERATED_USTRUCT_BODY()
+
+    /** A reference to the Actor class you want to spawn or track */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Biome")
+    TSoftClassPtr<AActor> ClassRef;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Biome")
+    float BiomeScale;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Biome")
+    int32 BiomeCount;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Biome")
+    int32 SpawnPerBiome;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Biome")
+    float RandomRotationRange;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Biome")
+    float ScaleRange;
+
+    /** Minimum distance between two placements of this type, closer ones are dropped. 0 allows overlap */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Biome", meta = (ClampMin = "0"))
+    float MinSpacing = 0.0f;
+
+    /** Keeps placements of every other type at least this far away, the larger radius of the two wins */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Biome", meta = (ClampMin = "0"))
+    float ExclusionRadius = 0.0f;
+
+    /** Higher priorities are streamed in first, every type is requested at once */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Biome")
+    int32 LoadPriority = 0;
+
+    /** Where on the island surface this type may be placed, only used with IslandSurface placement */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Biome")
+    FSpawnSurfaceFilter SurfaceFilter;
+
+    /** Biomes this type is placed in and how strongly, empty places it anywhere the filter allows. Only used with IslandSurface placement */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Biome")
+    TArray<FSpawnBiomeWeight> BiomeWeights;
+    
 };
\ No newline at end of file
@@ -1,25 +1,58 @@
-// The source code, authored by Zoxemik in 2025
-
-#pragma once
-
-#include "CoreMinimal.h"
-#include "SpawnInstance.generated.h"
-
-USTRUCT(BlueprintType)
-struct FSpawnInstance
-{
-    GENERATED_USTRUCT_BODY()
-
-    /** A reference to the Static Mesh you want to spawn or track */
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Biome")
-    TObjectPtr<UStaticMesh> ClassMeshRef;
-
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Biome")
-    float BiomeScale;
-
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Biome")
-    int32 BiomeCount;
-
-    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Biome")
-    int32 SpawnPerBiome;
+// The source code, authored by Zoxemik in 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SpawnPlacement.h"
+#include "SpawnInstance.generated.h"
+
+USTRUCT(BlueprintType)
+struct FSpawnInstance
+{
+    GENERATED_USTRUCT_BODY()
+
+    /** A reference to the Static Mesh you want to spawn or track, loaded asynchronously by the spawner */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Biome")
+    TSoftObjectPtr<UStaticMesh> ClassMeshRef;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Biome")
+    float BiomeScale;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Biome")
+    int32 BiomeCount;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Biome")
+    int32 SpawnPerBiome;
+
+    /** Minimum distance between two placements of this type, closer ones are dropped. 0 allows overlap */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Biome", meta = (ClampMin = "0"))
+    float MinSpacing = 0.0f;
+
+    /** Keeps placements of every other type at least this far away, the larger radius of the two wins */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Biome", meta = (ClampMin = "0"))
+    float ExclusionRadius = 0.0f;
+
+    /** Higher priorities are streamed in first, every type is requested at once */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Biome")
+    int32 LoadPriority = 0;
+
+    /** Where on the island surface this type may be placed, only used with IslandSurface placement */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Biome")
+    FSpawnSurfaceFilter SurfaceFilter;
+
+    /** Biomes this type is placed in and how strongly, empty places it anywhere the filter allows. Only used with IslandSurface placement */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Biome")
+    TArray<FSpawnBiomeWeight> BiomeWeights;
+
+    /** Use a hierarchical instanced component, its cluster tree culls instances per cluster instead of one by one */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Rendering")
+    bool bUseHierarchicalInstances = true;
+
+    /** Distance where instances start fading out, 0 disables culling */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Rendering")
+    int32 InstanceStartCullDistance = 0;
+
+    /** Distance where instances are fully culled, 0 disables culling */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Rendering")
+    int32 InstanceEndCullDistance = 0;
 };
\ No newline at end of file
@@ -0,0 +1,47 @@
+// The source code, authored by Zoxemik in 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "IslandBiome.h"
+#include "SpawnPlacement.generated.h"
+
+UENUM(BlueprintType)
+enum class ESpawnPlacementMode : uint8
+{
+	/** Random points on the navmesh, spawning waits until the navmesh for the island is built */
+	NavMesh,
+
+	/** Points sampled by area straight from the generated island surface, spawning starts as soon as the mesh exists */
+	IslandSurface
+};
+
+USTRUCT(BlueprintType)
+struct FSpawnSurfaceFilter
+{
+    GENERATED_USTRUCT_BODY()
+
+    /** Steepest surface, in degrees, a placement may land on. Only used with IslandSurface placement */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Surface", meta = (ClampMin = "0", ClampMax = "90"))
+    float MaxSlopeAngle = 90.0f;
+
+    /** Height band, relative to the island constructor, placements may land in. The water plane is 0 */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Surface")
+    float MinHeight = -100000.0f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Surface")
+    float MaxHeight = 100000.0f;
+};
+
+USTRUCT(BlueprintType)
+struct FSpawnBiomeWeight
+{
+    GENERATED_USTRUCT_BODY()
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Surface")
+    EIslandBiome Biome = EIslandBiome::Lowland;
+
+    /** Relative share of placements in this biome, per unit of area */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Surface", meta = (ClampMin = "0"))
+    float Weight = 1.0f;
+};
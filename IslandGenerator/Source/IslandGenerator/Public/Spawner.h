@@ -1,72 +1,197 @@
-// The source code, authored by Zoxemik in 2025
-
-#pragma once
-
-#include "CoreMinimal.h"
-#include "SpawnData.h"
-#include "SpawnInstance.h"
-#include "GameFramework/Actor.h"
-#include "Engine/StreamableManager.h"
-#include "Spawner.generated.h"
-
-class ANavigationData;
-
-UCLASS()
-class ISLANDGENERATOR_API ASpawner : public AActor
-{
-	GENERATED_BODY()
-	
-public:	
-	ASpawner();
-	virtual void BeginPlay() override;
-
-	UFUNCTION()
-	void SpawnRandom();
-
-protected:
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Default")
-	TArray<FSpawnData> SpawnTypes;
-
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Default")
-	TArray<FSpawnInstance> SpawnInstances;
-
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Default")
-	TObjectPtr<ANavigationData> NavData;
-
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Default")
-	float Step; // Snapps spawned object to a grid
-
-private:
-	UFUNCTION()
-	void AsyncLoadClasses();
-	UFUNCTION()
-	void AsyncClass();
-	UFUNCTION()
-	void OnAsyncClassCompleted();
-
-	UFUNCTION()
-	void ReadyToSpawn();
-
-	UFUNCTION()
-	void GenerateAssets(TSubclassOf<AActor> Class, FSpawnData SpawnParams);
-	UFUNCTION()
-	void GenerateInstances(UInstancedStaticMeshComponent* MeshClass, float Radius, int32 BiomeCount, int32 MaxSpawn);
-
-	UFUNCTION()
-	void FinishSpawning();
-
-	UFUNCTION()
-	FVector SteppedPosition(FVector Param);
-
-	bool bAsyncComplete;
-	bool bAutoSpawn;
-	bool bActorSwitch;
-
-	int32 ClassRefIndex;
-	int32 IndexCounter;
-	int32 Counter;
-
-	FTimerHandle NavCheckHandle;
-
-	FRandomStream Seed;
-};
+// The source code, authored by Zoxemik in 2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SpawnData.h"
+#include "SpawnInstance.h"
+#include "GameFramework/Actor.h"
+#include "Engine/StreamableManager.h"
+#include "Spawner.generated.h"
+
+class ANavigationData;
+class AIslandConstructor;
+class FSpawnSpacingGrid;
+class FIslandSurfaceSampler;
+class FIslandTerrainGrid;
+
+// One actor waiting in the frame-budgeted spawn queue
+struct FQueuedSpawn
+{
+	TSubclassOf<AActor> Class;
+
+	FTransform Transform;
+};
+
+UCLASS()
+class ISLANDGENERATOR_API ASpawner : public AActor
+{
+	GENERATED_BODY()
+	
+public:	
+	ASpawner();
+	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+	UFUNCTION()
+	void SpawnRandom();
+
+	// Places on the given island's surface from this seed instead of the GameInstance one, call before BeginPlay
+	void ConfigureForIsland(AIslandConstructor* InConstructor, const FRandomStream& InSeed);
+
+	// Places from this seed instead of the GameInstance one, call before BeginPlay
+	void SetSeed(const FRandomStream& InSeed);
+
+	// Runs a whole spawn pass right away on a surface in SurfaceToWorld's space, with the same placement, spacing and
+	// components as IslandSurface mode. Assets load synchronously, the scheduler and the frame budget are skipped. For
+	// tools without a running world such as the benchmark commandlet. Returns the number of actors and instances placed
+	int32 SpawnImmediately(TSharedPtr<const FIslandSurfaceSampler> Surface, TSharedPtr<const FIslandTerrainGrid> Grid, const FTransform& SurfaceToWorld);
+
+	// Destroys every actor this spawner spawned and stops any spawning still in progress
+	void ReleaseSpawnedContent();
+
+	// Share of the queued actors spawned so far, 1 once spawning is complete
+	UFUNCTION(BlueprintPure, Category = "Spawner")
+	float GetSpawnProgress() const;
+
+	// Placements of one SpawnInstances entry when they are kept as data instead of instanced components
+	UFUNCTION(BlueprintPure, Category = "Spawner")
+	TArray<FTransform> GetInstancePlacements(int32 InstanceIndex) const;
+
+protected:
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Default")
+	TArray<FSpawnData> SpawnTypes;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Default")
+	TArray<FSpawnInstance> SpawnInstances;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Default")
+	TObjectPtr<ANavigationData> NavData;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Default")
+	float Step; // Snapps spawned object to a grid, 0 disables the snapping
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Placement", meta = (ToolTip = "IslandSurface samples placements straight from the generated island mesh and starts as soon as it exists, instead of waiting for the navmesh build"))
+	ESpawnPlacementMode PlacementMode;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Placement", meta = (ToolTip = "Island to sample in IslandSurface mode, the first one in the level when left empty"))
+	TObjectPtr<AIslandConstructor> IslandConstructor;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Spawning", meta = (ClampMin = "0", ToolTip = "Game thread time per frame spent spawning SpawnTypes actors, the rest waits for the next frame. 0 spawns everything at once"))
+	float SpawnBudgetMs;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Server", meta = (ToolTip = "On a dedicated server SpawnInstances placements are only stored, see GetInstancePlacements, no meshes are loaded and no instanced components created"))
+	bool bInstancesAsDataOnServer;
+
+private:
+	// Requests every class and mesh the spawner references at once, one streamable handle per type
+	UFUNCTION()
+	void AsyncLoadClasses();
+	UFUNCTION()
+	void OnAsyncClassCompleted();
+	UFUNCTION()
+	void OnAllAsyncClassesCompleted();
+
+	TSharedPtr<FStreamableHandle> RequestSpawnAsset(const FSoftObjectPath& Path, int32 Priority);
+
+	// The type ReadyToSpawn is on next has its class or mesh resident
+	bool IsCurrentTypeLoaded() const;
+
+	// Starts SpawnRandom once the world's generation scheduler has a free spawning slot, right away without one
+	void QueueSpawning();
+
+	// Hands the spawn pass's slot back to the world's generation scheduler
+	void ReleaseScheduledJob(bool bCompleted);
+
+	UFUNCTION()
+	void ReadyToSpawn();
+
+	// Navmesh idle in NavMesh mode, island surface published in IslandSurface mode
+	bool IsPlacementReady() const;
+
+	void OnIslandSurfaceReady(AIslandConstructor* Constructor);
+
+	UFUNCTION()
+	void GenerateAssets(TSubclassOf<AActor> Class, int32 TypeIndex);
+	UFUNCTION()
+	void GenerateInstances(UInstancedStaticMeshComponent* MeshClass, int32 InstanceIndex);
+
+	// World transforms for one SpawnTypes or SpawnInstances entry. Every biome draws from its own substream of the
+	// seed, so the result is the same whatever order or thread the entries are computed on
+	void ComputeTransforms(bool bInstances, int32 EntryIndex, TArray<FTransform>& OutTransforms);
+
+	// Drops placements that break the entry's MinSpacing or another type's ExclusionRadius, and keeps the rest in the grid
+	void ApplySpacing(bool bInstances, int32 EntryIndex, TArray<FTransform>& Transforms);
+
+	// IslandSurface mode: places every biome of every entry in parallel on worker threads
+	void PrecomputeSurfaceTransforms();
+	void PrecomputeSurfaceTransforms(TSharedPtr<const FIslandSurfaceSampler> Surface, TSharedPtr<const FIslandTerrainGrid> Grid, const FTransform& SurfaceToWorld);
+
+	// Fresh spacing grid for a spawn pass, sized for the widest spacing of any type
+	void ResetSpacingGrid();
+
+	// Spawns one queued actor with its construction script run once on the final transform, null if it failed
+	AActor* SpawnQueuedActor(const FQueuedSpawn& Spawn);
+
+	// Plain or hierarchical instanced component for one SpawnInstances entry, registered and attached
+	UInstancedStaticMeshComponent* CreateInstanceComponent(const FSpawnInstance& SpawnInstance);
+
+	bool StoresInstancesAsData() const;
+
+	// Same placements GenerateInstances would submit, kept in InstancePlacements
+	void StoreInstancePlacements(int32 InstanceIndex);
+
+	// Spawns queued actors until the frame budget runs out, then continues next frame
+	UFUNCTION()
+	void DrainSpawnQueue();
+
+	UFUNCTION()
+	void FinishSpawning();
+
+	void NotifySpawningComplete();
+
+	UFUNCTION()
+	FVector SteppedPosition(FVector Param);
+
+	bool bAsyncComplete;
+	bool bAutoSpawn;
+	bool bActorSwitch;
+
+	int32 IndexCounter;
+	int32 Counter;
+
+	FTimerHandle NavCheckHandle;
+
+	// Parallel to SpawnTypes and SpawnInstances, null where there was nothing to load
+	TArray<TSharedPtr<FStreamableHandle>> TypeLoadHandles;
+	TArray<TSharedPtr<FStreamableHandle>> InstanceLoadHandles;
+
+	TSharedPtr<FStreamableHandle> CombinedLoadHandle;
+
+	TArray<FQueuedSpawn> SpawnQueue;
+	int32 SpawnQueueHead;
+
+	// Every type has been placed, completion only waits on the spawn queue now
+	bool bPlacementFinished;
+
+	// Parallel to SpawnTypes and SpawnInstances, consumed as each entry spawns
+	TArray<TArray<FTransform>> PrecomputedTypeTransforms;
+	TArray<TArray<FTransform>> PrecomputedInstanceTransforms;
+
+	bool bTransformsPrecomputed;
+
+	bool bSeedFromGameInstance;
+
+	// Job of the current spawn pass in the world's generation scheduler, INDEX_NONE when there is none
+	int32 ScheduledJobId;
+
+	TArray<TWeakObjectPtr<AActor>> SpawnedActors;
+
+	// Parallel to SpawnInstances, only filled when StoresInstancesAsData
+	TArray<TArray<FTransform>> InstancePlacements;
+
+	// Every placement accepted in this spawn pass
+	TSharedPtr<FSpawnSpacingGrid> SpacingGrid;
+
+	FRandomStream Seed;
+};